@@ -0,0 +1,38 @@
+#pragma once
+#ifndef BE_LIMP_ATOMIC_FILE_HPP_
+#define BE_LIMP_ATOMIC_FILE_HPP_
+
+#include <be/core/filesystem.hpp>
+
+namespace be::limp {
+
+Path unique_temp_path(const Path& path);
+void put_file_contents_atomic(const Path& path, SV contents, bool text = true);
+void replace_file(const Path& temp_path, const Path& path);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Holds an exclusive advisory lock on a file shared between
+/// concurrent limp invocations.
+///
+/// \details The lock is taken on a separate "<path>.lock" file, which is left
+/// in place afterwards, so that the locked file itself can still be replaced
+/// atomically while the lock is held.  Blocks until the lock is acquired.
+class FileLock final {
+public:
+   explicit FileLock(const Path& path);
+   ~FileLock();
+
+   FileLock(const FileLock&) = delete;
+   FileLock& operator=(const FileLock&) = delete;
+
+private:
+#ifdef _WIN32
+   void* handle_;
+#else
+   int fd_;
+#endif
+};
+
+} // be::limp
+
+#endif
@@ -0,0 +1,13 @@
+#pragma once
+#ifndef BE_LIMP_C_STRING_LITERAL_HPP_
+#define BE_LIMP_C_STRING_LITERAL_HPP_
+
+#include <be/core/be.hpp>
+
+namespace be::limp {
+
+void append_c_string_literal(S& out, SV data, std::size_t line_length, SV line_separator);
+
+} // be::limp
+
+#endif
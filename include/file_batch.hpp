@@ -0,0 +1,51 @@
+#pragma once
+#ifndef BE_LIMP_FILE_BATCH_HPP_
+#define BE_LIMP_FILE_BATCH_HPP_
+
+#include <be/core/filesystem.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Reads a set of files concurrently on background threads.
+///
+/// \details Reads begin as soon as the batch is constructed.  Results are
+/// available in the same order as the paths were provided once ready()
+/// returns true, or after wait() returns.
+class FileBatch final {
+public:
+   explicit FileBatch(std::vector<Path> paths);
+   ~FileBatch();
+
+   FileBatch(const FileBatch&) = delete;
+   FileBatch& operator=(const FileBatch&) = delete;
+
+   std::size_t size() const;
+   bool ready() const;
+   void wait();
+
+   const Path& path(std::size_t index) const;
+   const S& contents(std::size_t index) const;
+   const S& error(std::size_t index) const;
+
+private:
+   void run_();
+
+   std::vector<Path> paths_;
+   std::vector<S> contents_;
+   std::vector<S> errors_;
+   std::vector<std::thread> threads_;
+   std::atomic<std::size_t> next_;
+   std::atomic<std::size_t> remaining_;
+   std::mutex mutex_;
+   std::condition_variable done_;
+};
+
+} // be::limp
+
+#endif
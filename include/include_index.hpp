@@ -0,0 +1,58 @@
+#pragma once
+#ifndef BE_LIMP_INCLUDE_INDEX_HPP_
+#define BE_LIMP_INCLUDE_INDEX_HPP_
+
+#include <be/core/filesystem.hpp>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+enum class IncludeLookup {
+   found,
+   not_found,
+   unindexed
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Caches directory listings so that include scripts and templates
+/// can be located without probing every include directory on disk.
+///
+/// \details Each cached listing is revalidated against its directory's
+/// modification time at most once per generation.  next_generation() is
+/// called whenever a new file begins processing, so an include directory is
+/// checked once per file no matter how many lookups search it.
+class IncludeIndex final {
+public:
+   IncludeLookup find(const S& name, const std::vector<Path>& dirs, bool files_only, Path& result);
+   void next_generation();
+
+private:
+   using mtime_type = decltype(fs::last_write_time(Path()));
+
+   struct Entry {
+      S name;
+      bool is_file;
+   };
+
+   struct Listing {
+      U64 generation = 0;
+      bool exists = false;
+      mtime_type mtime = mtime_type();
+      std::unordered_map<S, Entry> entries;
+   };
+
+   const Listing& listing_(const Path& dir);
+
+   std::mutex mutex_;
+   U64 generation_ = 1;
+   std::unordered_map<S, Listing> listings_;
+};
+
+IncludeIndex& include_index();
+
+} // be::limp
+
+#endif
@@ -5,6 +5,8 @@
 #include "language_config.hpp"
 #include <be/core/lifecycle.hpp>
 #include <be/core/filesystem.hpp>
+#include <be/belua/context.hpp>
+#include <memory>
 #include <unordered_map>
 #include <set>
 #include <vector>
@@ -19,9 +21,16 @@ public:
    int operator()();
 
 private:
+   bool parse_inputs_only_(int argc, char** argv);
+   void set_depfile_path_(const S& str);
+   void run_();
    void init_default_langs_();
    void load_langs_();
    void get_paths_(const S& pathspec);
+   void select_affected_();
+   void parse_shard_(const S& str);
+   std::vector<Path> schedule_();
+   const LanguageConfig& comment_language_(const Path& path);
    void process_(const Path& path);
 
    CoreInitLifecycle init_;
@@ -34,10 +43,19 @@ private:
    bool stop_on_failure_ = false;
    bool force_process_ = false;
    bool write_hashes_ = false;
+   bool streaming_ = false;
+   bool reuse_contexts_ = false;
+   bool list_affected_ = false;
+   bool record_costs_ = false;
+   U32 shard_index_ = 0;
+   U32 shard_count_ = 0;
    Path depfile_path_;
+   Path metrics_path_;
    std::vector<Path> search_paths_;
+   std::vector<Path> affected_by_;
    std::vector<S> jobs_;
    std::set<Path> paths_;
+   std::unordered_map<S, std::unique_ptr<belua::Context>> contexts_;
 };
 
 } // be::limp
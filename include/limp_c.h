@@ -0,0 +1,76 @@
+#pragma once
+#ifndef BE_LIMP_LIMP_C_H_
+#define BE_LIMP_LIMP_C_H_
+
+#include <stddef.h>
+
+#if defined(_WIN32) && defined(LIMP_BUILD_SHARED)
+#define LIMP_API __declspec(dllexport)
+#elif defined(_WIN32) && defined(LIMP_SHARED)
+#define LIMP_API __declspec(dllimport)
+#else
+#define LIMP_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Stable C interface for processing in-memory buffers with LIMP.
+ *
+ * Sessions and results are opaque and must be released with the matching
+ * destroy function.  A session may only be used by one thread at a time.
+ * Strings returned from a result remain valid until the result is destroyed.
+ * All strings passed in are UTF-8; content may contain embedded nulls.
+ *
+ * LIMP scripts resolve relative paths against the process's working
+ * directory, including in the worker threads used by read_files() and
+ * --isolated comments.  By default the working directory is left alone.  A
+ * session created with LIMP_SESSION_CHANGE_DIRECTORY switches it to the
+ * directory of each path passed to limp_process() and restores it
+ * afterwards; other host threads may see it change, and such calls are
+ * serialized across all sessions.
+ */
+
+typedef struct limp_session limp_session;
+typedef struct limp_result limp_result;
+
+/* Set struct_size to sizeof(limp_language); fields may be added to the end
+ * in later versions, and will take their defaults when not provided. */
+typedef struct limp_language {
+   size_t struct_size;
+   const char* comment_opener;   /* e.g. slash-star */
+   const char* comment_closer;   /* e.g. star-slash */
+   const char* limp_opener;      /* NULL for the default "!!" */
+   const char* limp_closer;      /* NULL for the default "!!" */
+} limp_language;
+
+/* Flags for limp_session_create(). */
+#define LIMP_SESSION_REUSE_CONTEXTS    0x1u  /* keep one warm Lua context per directory */
+#define LIMP_SESSION_CHANGE_DIRECTORY  0x2u  /* see above */
+
+LIMP_API limp_session* limp_session_create(unsigned flags);
+LIMP_API void limp_session_clear_contexts(limp_session* session);
+LIMP_API void limp_session_destroy(limp_session* session);
+
+/* Returns NULL only if the result itself can't be allocated; otherwise check
+ * limp_result_error() to see if processing failed. */
+LIMP_API limp_result* limp_process(limp_session* session,
+                                   const char* content, size_t content_length,
+                                   const char* path,
+                                   const limp_language* language);
+
+/* Returns NULL if processing succeeded, or an error message otherwise. */
+LIMP_API const char* limp_result_error(const limp_result* result);
+/* Nonzero if any generated code differed from what was already in the buffer. */
+LIMP_API int limp_result_modified(const limp_result* result);
+LIMP_API const char* limp_result_output(const limp_result* result, size_t* length);
+LIMP_API size_t limp_result_dependency_count(const limp_result* result);
+LIMP_API const char* limp_result_dependency(const limp_result* result, size_t index);
+LIMP_API void limp_result_destroy(limp_result* result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -8,101 +8,150 @@
    fn = require_load_file(be.fs.canonical('../meta/limp.lua'), '@LIMP core'),
    deflate = true,
    symbol = 'BE_LIMP_COMPILED_LUA_MODULE',
-   line_length = 150 }) !! 97 */
+   line_length = 150 }) !! 146 */
 /* ################# !! GENERATED CODE -- DO NOT MODIFY !! ################# */
-#define BE_LIMP_COMPILED_LUA_MODULE_UNCOMPRESSED_LENGTH 12598
-#define BE_LIMP_COMPILED_LUA_MODULE_LENGTH 4826
+#define BE_LIMP_COMPILED_LUA_MODULE_UNCOMPRESSED_LENGTH 19518
+#define BE_LIMP_COMPILED_LUA_MODULE_LENGTH 7373
 #define BE_LIMP_COMPILED_LUA_MODULE \
-   "x\332\275Z}\220\33Ev\357\236i\215\264\337\376\2b\373\260e\263`\273ls!!\334\25\20\30\255v\327\230\263\327w\266C\35\307\31\241\225f\327\302ZIH\263\266!" \
-   "\225\363\b\331\273`\354\0\6|\206\303\300\301\232K\310R\225\253K\352\362Q\251H^gIB*wU$\225\324U \25\312I\352\302&\251\312\327\37\311\35\227\367\272_" \
-   "\217FZi\261\311\207\252~\232\356\236\236\376x\357\365{\257_\367\332]\223\311}l\365s=\235k\72EDD\42G\357c\365\337\346\43\66\357\262w\355\334\375\305h*_" \
-   "t\374rc\305\31\370\267\230\315\206m\233My6\233\257\332\314\342""16\34\213\261\251r\214\315\327b\314\62\6\330\360\300\0\233z|\200\315_\34`\334\64\331" \
-   "\345\307\31\267\346\6X,n\262\376\n\343\303\220.WL\226\206\264gzb~.\316f \275\236\r\206\327\331\334{\327d\f\312\303U\223\205\254Kqf\v\26\276\34\367x" \
-   "\304\273\364\4\276;9WyrA>\315\223\vq\231\?\271Pa,R5\237\372`\356'\307\42\354\322S\21\66x*\342\315\237\212\260wNC\376\227!\377\64<\1\203\317\314\316A]" \
-   "\257\362\314\254\311\341i>[\236\213\260\205\70\307\357\317,T\360Y9\263\60'\363\317-\230\6\346\237[\210\343\323|~\241\42\363\317c\?\263s\6~\377\302q\30" \
-   "Km\256\223m\23&\313\16\232,b\213\263\331\343\370<~6{I\346\277\236\25\2\363_\317\16\342S\234\223\337W\4\216\343\334\354\34>\315\27\237\202v\26\314\20" \
-   "\266\377\342B\34\237\346K\v\25\231\177\t\353OWv[P\357\33\263s!\374\356\33\263\246\205\337\275<\35\377S(\257\274<]\301\247y~zN\346\317O\233\337\303\374" \
-   "\53\323q|V^\231\256\310\374\253\323s2\377\352\264\371}\314\277\66\35\307g\345\265\331\270l\357\233\263\25|V\276\71;'\363\257\317\232a\314\277\216\343C" \
-   "\372o\33\204<\23ol;\216\317\343ol\273$\363\63rNf\4\353\316\314\306\361i^\230\232\333\313\336\61\337\vY\203\373\330e\223\361\31\340\327M\314c\43 K\302r" \
-   "\223\243YGXigtr\\\204Kn1\223\33\27\35n\236R!\367\321\202\3\345N\326I\271\42\234)$3\305\222\b\247\363c\31\370,\224\315'\323\242g\334q'\34\67\251\232" \
-   "\352)\5s\221\242\363\310d\246\b=\214\72\67\217\225D\4\36\223n&\53\302\220\30\315\272\302L\354`\242\43\221\330\267\177\357\316\370~\316EW\42\221vR\331d" \
-   "\321Ic\72\347\34\311\344\322\316Q\21I$T\42<\236\315\217&\263bU6Yr\23\343N\316)&]'\235HC\227\242{4Yrd\305\234\53\272\325\63Q\312<\346\254\64i\21\371" \
-   "\245\251\203\311\242\60\242\242;\233\231(\24S\211B\322=(\302\205\242\63\226\201\336\n@\1Lt\24\363y7\221\316\24\305r\240\310D\302-&3Y\240L\342HItc\245B" \
-   "1\237rJ\245\225z\221\212. \207\36A\317\221b\306\365\307\323StJ\365wazvL\346(\325\25x\273\214F\t\363\207\356\234\322J\256\333\67sYa\311vED>\262\71\321" \
-   "\255\372\221\65\205\45\273\321}\323\204z)G\323Z\211\203L;\5dc\302M\26!\253\253P\251\350\202\204\203\203H=\212\43\227lLH\206\257\b\346\22\262\362\nlO6" \
-   "\226\312\347\\\30xI\212E\302u&\nY`\217\270\266\350\214gJ\256S\364\213$Q\257[\\,\333[\275\270\234$\322*\214\227&GE\304\71Z\310\346\323\216\20\5\30Q\250" \
-   "(\377\263\370\337\341\367\331\247&\344\347\273T^\315NS'\237\22\335\212c\251\354$\264w\215\337\63\225\310qBi)\237=\354\370\205RZ\42\372\243^\20\241|" \
-   "\321M(Qj\316v\27@\232\201\227\362\233NI\45L\42G9\333\210L\335\n\270\25\0\232j=<\346A\305\177\b\317uv\310\233\267\253\354\35\333\343\37\332\230\27\336" \
-   "\274gs^c,\306\71\273\354y\374\35\273\306\23^\215\257c\206\227\250\302\323\343\236\305A\325\307\f\6IV\53\33\354\0\374\225\341\233\376\230\307\255X\225u" \
-   "\326.B\37q\354\236\201\266\207z\214_\266\231\201j\241\ae\314_\220\r\313\61\2t\312\344\306\362\53\r-\213\306>\21\72r0\351\212\320D2\223\23F\\XN\261\230" \
-   "/\212h\262T\312\214\347\242n>\72\231\323\rD\17'\213\31T\v\321M\302\330\4k=\\L\36\1QUK\223\367r)\343H\200mK`{\v\334\334\204\317.\201[\b\?\333\2\310\3" \
-   "\201\226\326\325\43\61r~\352\260\237\72\322\r\377\253\45\277\30\v\45\206F\356\63'\\\245C\331mPt\aVb\326ZxL\1\53_g\212uS\300\312i\233\361\327\45\53M\17" \
-   ",8\257Ua\346\60\361\31`\345\264\35\3V\306$\v\247\252\61V\203F\300>KV\276o\227\45\333g@\24\246\274\1V\225$\363\330\5`\336\233Li\364\256O\305\272\72\323" \
-   "\272\2\374Y\261)\232)Esy7\352\267\201\334\32o\346\26\316\361s\237\22\237_\2\267\267\200\42\253\346\316Z\237;k[s\342\347\241\350n9V\v)\23\2|\1\360\66" \
-   "\340\20p\240\37\350\276\316f\336\60\257\262{c\266\261\305c\354\255\352\307\307\220\222\206T\344u\372qn\310vx/\266\207\255\335u\205\270\233z^\266y,_" \
-   "\214\222\265\312\27\267`Y'\240[\226\227\300^\72~Y\257,CEZ\314g\375R\43a\301\177DJ\242\237\2\220Q\206y\263\335\220\335\43\265J\b\277\330\5\262W\203\231" \
-   "\362\62ci\230\324.\220\32-o\340U\32c$7\330\203\bI\265\332\365@\264\343\300\326\315=wwn\21\346\215\267\210\260\314\367\vm}\344HF\256\0j\30\320.\250m" \
-   "\375\235\374}\t\260O\276\64\261\337a\30\43\20\36\307\303\365x\344w\213\314\255\?\4\71\336\275M\330\327\324_\210\362R&\330\227!\365\240\374\326ZA/\320" \
-   "\205NxU\266\256\n\42\200i \316\72\360z-H\333\270p\253U\320\221\61\26\2\335\210\356u_\214\33\270H\17x\36\203\201r\34(\262A\360\6\247\203\tQt\n\215NF" \
-   "\320\17\241\325c(I\302\301\334\17\370J\33<\0\70p\5x\220&\25.\72\356\341d\226S\323\376\242 \307\256/5Y\224\226\210\306\372\20\274\?\250\324\301\65\264" \
-   "\263H\300\364q\a \323\260\303X\a\326\301\202]\6\362\251\37t\227\5Zi\330\216\261\23\320\341\274\27cOW\31\357\a\262\350\272\303U\305\317\264\255H\24\226" \
-   ".W\3\201\270v_\256\206R8\276d\33\214\6\220n\3\207\60\26\300AM5\325k\37u\363IT{\30\336g\325\206\314\244\26\72\2\222\353{\202\322\276\313\301c\265C\204l" \
-   "\340ms\313\250\315\36\221\357\214\260\264\65\266\24I\16\362\70\4\371\335\320\303N\352I\352q\337)\254w\205\337\345\3(\4\360\b\325\264R\371\311\234\253k" \
-   "\267\32H\t\312\16\267\37\310\310\25\16\304\r`2\200\303W<\220\243P\366\230\32\210\21\240scW\370\346Q\277b\260Y\243M\263_\203\262\262|g5(\312\30\350\205" \
-   "\262\315\322e\217]\17\353=-\247\347A\227J\230\315\272\242\64\72\203\216~]7as\307>\1\236\337{\243~\254\353\253iH\235V\42\326A\v\263\337V\6\276\3\305" \
-   "\314\226\244\340\226\247\312\375\261\65\354\60\352[\206\206\255\200o\277Q\336\45E\237 <I8I8E8M\355\370\vC\344']0\275OC\376\254\32e\17\251\\))\240\1B0" \
-   "\42\34\31\224\361\b\250\24|\366\300h\345\250\253U\256G-\224/\322\271h\254\264\rR\43]\246\306\312\244s\372L\0\317\22\236\43<\37\300\v\204\263\272e\4\f<" \
-   "\224\311e`\364\212\320\347\240\360\rI\217\360\352\66S \241\347 \23\354\37\231\264\244\fd\204m\366\f\17\215\3(K\376\66\f\277\37X\232`\266\261\16\334" \
-   "\262!(\213\260\262\201\317\335\261\252\261\23\236\233\252\?\72\246\31U_0\302\270\301\237dHM\23\a\362b\0/\21^^\2\347\233\360\n\341U\302k\1\274Ls\16\371" \
-   "\356\207\334XoA\351\372)\277\f\366.\31\327/\353\42\67\305)\370EF\6\275\340\353\60ut\31\245\32hLQ\3\20\224\vP\374mE\345\265\377\17T\6{e4\bX\3\265a\377" \
-   "\34j\242\270r!\337\f\340[\204_]\2o5\341\327\b\263\204\267\3\300\372\277N\370\366\377\r\355C-i\257\304\374;\360\356\367\?\45\3\230yU\f\30\256\331F\72" \
-   "\346\261M\266\22\367\253`\300o\4\360\233\204\357.\201\337j\302o\23~\207\360\273\1\374\36\341\273D\211V\fX\323\202\1k\26\63`\215\317\200\325>\3V\177\2" \
-   "\3`\347\306\276\257\224\350um\30\0\216\247T\213\226W\345hd\373\201'\203\360DC\vyc\252js`\n_\17\215I\247\265\212[w\311(\36\64R!I\347\246xO\30v\23)\330" \
-   "\354\5CV\242cl2\227r3\371\234f\a\232 .\31\206\203\274\30\300\34a\236\360\207\1\374\21\341\335\26\370\223&|\217\350\240M_g\53\341\225$S\221I\31\177d" \
-   "\357\301\333\37(\371\351\v\372\251@\5\64\201\332\67\225\241\217\252\62\211\26\270\356\350\247\226=\316\346a/\335O\341\r\334\65\351(\37\323\216(\206" \
-   "\324\374XZo*\?1\201\276\302\250\63\236\311\255\332\25\275\241\371\27\335\260!\272chdhol\377\320`4\276gp(\272}{tpOtd\317\376\350\356=\203;\207\357\307*" \
-   "\213\277\23\335\272m'\227\256\373\f8\247\?\v\340\317\233\360\27\204\277l\201\37\4\34/\45j\177\5\251\313\212X\313\3\276\203e\223C_\45\207\336\16\20\215" \
-   "\305T\35Y\336\206h\215\321K\35 m\240\341'\223\316'\305\320\310`t\317p3\31\333\327oC\72\234\341\373\204\17\2\370\353&\374\r\341\303\26\270\274\210\204" \
-   "\?\204\324Gj\265F\210\204a W\30e\rH4\5\344\272\21\274\341\233\202\373gs\24h0V\22\53\222\71X\\\260\305O\24\235l\322\315\34v\2!\277z8\271>\5\354\341\37" \
-   "\226\300G\213\206\207\352y\271l\240\363\36\32\36F\21\345V\r\322\353m\345\255\337D\236b\34w\263^UF\25g\240H\206\243\30\206\230\352e\330~\34\352\343\324" \
-   "`\227\v\336\60g\347ak\367.\72\253\240\24>B\351(\307\330\20\244\373\71\6N\270\367U\3\264\376\305\232\370cvQ\370\351jYl\1\v\361V\355\307\307\254\330Ei5" \
-   "\300b\360*(0\f\42\354*\17\260\371\332\200\1~5\277\f\345\34\266P\357\363\307\315m\340gCu\364\274\321\343""66\306\220\217\334\263Q\265A\33\265\230\311" \
-   "\256\257\226\215\17\252\?96j\323\370\275\71\220\322\71f\301$\201\207|\306\306p\333\45\71'\234\21\206\312\220\6\313\245\364\352`\267d\3\27a\347h\246" \
-   "\344\226Z\5\256[\305\306\215\333\205\45\303,\1K\26\365\265\252\332\22t\343\177\302)\245\222xd\362\300\203=\235\a\266\342>\241;Ut(\336]j\214\5\257(L6u" \
-   "\36R\254\356\2m\f\16\263\354\313\204\177K\246\214\220t\302=\351\264\207\2*\337\337\352\bn\352\340\aR\33\21\42X4p\254\327\67\6\33\244tB\222\0\66\270>m" \
-   "\360\374\0\45\352\237\332\340\237\1\377\2\370W\300\277\265\300\277\67\341\?\0\377\331\204\377\n\340GM\370q\0\37\a\240\337\53\71\255\303\340\212<\255`" \
-   "\21t\72B\350hB'\240\207\320\333\2\313\232\200\v\17\255V\204\210\206\313\27i\326\247\211\250\4\253\203\212\311\324\240\215\273\23""70AR\257\241\302\346" \
-   "\330\340\365R\257\64\306\6uYclP\227\32\207\326\241\307 c\203\72\325\304\344\255\324Y\310\17\224\216\225B0\232\22\35\1\216f]\351\246]\307\345n\33C[Z" \
-   "\251$h\373\217\33\71\?\72\312\71\257\357\300\261\366*\336\210k\374\306\240C\24w]Q\26`\317l-$o\344\62V\276\201b\345\30\327\226JJ\306\310\271\214\231" \
-   "\327<\365U\f\274(\214\203\303B\347Z\t\200\16a\363`\262\360\375e\370\356\0(\255)\257&\315\27\226\r\363\213\240\34<\245\34\354\1\277\375yo\200\63\345" \
-   "\326\262\277\205\367\177\27\214\241k\345@q\361\360\27a\364*&\236\316;**.kl\20\206-zqnr\25\347\222\23\215\307f-lA\375<\261\325\221Y\360`M\306\226`8\34=" \
-   "M\206\364\371\f_\214\353\333`=!\332\2\33\333\340\206\0\372[\0Ye\6\271\211\203\352J\35\234\314\35J\340\334uQ\207\236\320Z*\300\217P\334P\354Bx\374\313" \
-   "\66AS\333\245p\204\256\rD\201\321\227\35\45\316\17\3\347q3\202\34\303\223\217\363`-0\252\70\f\376\357\24p\34\313\255r\215\315\0\367\240\34,slQ$9ru\334" \
-   "\374\37\360\316 n\341\17g\264\231/\306\226\66\330\332\6\333\232\260\275y5]K\372\\\323\226\335\16\257\357\304Z\334\f7\221\365\355@\0\324\17\262\67\234" \
-   "\321\312\345\334\243\243qw\360\326\270\223\6\321\353\37\314j\326\353\30\236T\45w\311\243E\34\211\325A\43\231\2\365\61\357)\333<\301\225\337\65\243B" \
-   "\305\365\b\26y\223\315\307\337\365S\335\272\343\204\355\336\315\227\206\335v\264\35\r.\25(\3\266C\311\343\312fy\224\356\222)\345\21\357\334H\271\253U" \
-   "\353r'\345\21\64\216GZ\b]\221\300\264\302A\31\274b\tkG\207\245\45\17\307\36\347\213\61\330\6CK`G\263\264\255l\226\266{\341\365\210\254\25\356\43\242" \
-   "\355\0\42!\341Pe\247=\217\303\246U\236\242t\203\356.\227\71\250\21\217K\276\3qNUk\370\344\376B53y\360\262\362@ a\264\247@\b\274\251\264\60\222\302Je" \
-   "\363\45\247q\33\365\5\276\30\273\226\300n\302\bWs\213\340.\43\231K\353\366\214\261\20\245\352\262\262\37\222\217\310iw\f\243\225\264\225\225\304\351c" \
-   "\300D\351(O\35.\201\325\304\303\42\334\273K\271\341\65\16\264\65@\233r\260B\352d\230\t\17-\30\270\327`\215\240n-\246\310d\343V[Y)\264l\340N\33\350N" \
-   "\227\313\6\253B\367\347k\334\354\207\235\332=P\341&\250\63_\305\257\321J\32\62x=\f}\235\200\276\322\352{\206\307\374\372$\372\323\364\307/\32\354<\370" \
-   "\353\r}\302\234A\327\310eVF\27\275\314\215\313\304\322^\271\234\225\316\335\270{\262\344FK\5'\225\31{4J\267&\242\245T1Sp\243\270\42""70\334\45\345\350" \
-   "\66Ix2WH\246\16\375\357\331R\264\323\241\233\263\223I\361\231\221\274\337\277t\220\242\23I7u\20\34$y)\301\322\301\361.\230]\237\62\275\310\344_\340\n" \
-   "\367\5p\?\340\53\204\a\0\17\266A\202\360P\33$\3\30m\203\24\0\267\275\343W\200\203\204L\33<\34\300\241\45\220\45=]h\3\\\3\250\334z\364\235\30\255Z\221`" \
-   "\35\332\357\264\250@\252\221>\375V\263i\r\271\231\346X.JI\377\335mt|\16\357\364Q\276\345\37\315I\257\243\4\252H\271\257=\201\313\72\45\345b\340\201" \
-   "\361/*\355\264\\\205\320\330WA,\361\340\5u\24z\257\277\2\211\251\30\307K\35\246\336\61\177\313\373\370\330i\250\201\367n\264S\31\251*\221\66\32B\231" \
-   "\235\251d.\237\313\244\222Y\251\202\373\224\22\306\276\360<\b1\331\204\303\1\34\241\262\307Z\0\207m\5U\357ry\327\301\240T0n\31\242\373\b\301\270\245." \
-   "\v\304-u\221\221\261\364u\202 \347\220j@K\366K\320\361\61I3\321\33\60\203\177\0\377\250\315}\327\214\312\361\314\f\243\4\372\275>\27\67t\274H^\231\222" \
-   "[]\271\372\224\251R!_l\377k\374\352q\254\331,\365\326\315R\303|X\5\252\235\270\ng(x\r\254nU\360\323\343\274\65N\320X\26\255\200p\343i\36$\317*\347b}` " \
-   "H=i\43\245S\341\325c3\36\367\356\261\275\62l\37\37\307cv\371\16\224j\5\236o\242\61!\347wF\6\203\61\202\307<\254[Qg\27\r\333\37tF.\320\231F=\222\aF\256" \
-   "\0\246\223.\261\335L\327\324\264\217\322p!\262\256c;eJ\26.q\277\315\337\265\204\365m\251'x\43\236l\201\223\200\247\0\247\2\70Mx\246\5\236\5\234!\274" \
-   "\320\6g\311\244\373\202\42\257n\25\4\245\202{\22\272\317z\206N\30{\311\344/\243\365\266\202\234\237UtA\340Z\nZ\257\16`M\0k\3\330\30\300\r\204~\302\215" \
-   "M\330\f\330B\270\225p\a\1\265\237\326\202\30\320\33$M\272\203\342\fxJp/\335p\332\43\357\n\250;1x\335\346>\272!\362e\272\363\360\20]Cx\230\356\4\344" \
-   "\350H\276Dg\350\372\320\35U\45\236\224\37\a\234\240s`<M}\232\16\20\317\321a\326\5\72S\371\16\5\367\365a\a\306\246\337\243\0\53F\245\377\236\242\231\?" \
-   "\244\370\45\306""11B\240\303\16k\b\270\317\\K\373\35\334(~\226\360\323\204[\b\?C\270\225\360s\204\333\b\237\43|\236\200[\227\333iSp\27y\270\3\344\374" \
-   "\241/\373\45\300^2l\373I\r\227H\345h\315\210K\276B\322\205\353\372\\\33\240\214(\323\204z@\336\333\227\267\322\f\312\321\335\22\223\262\365\33\327T " \
-   "\17>B~ey\230d\351\254\272\361\25\326Y\45\275\21\375\45\72<\35\224i\270\233\335\251\v\203W\264\273\250\20\326B\257n\1\355\347r\312\340nn\225\256\63\341" \
-   "^G\362\331t\243\342\66\22K<\303\31&\321\63r;(\45Ou\356\321\31\f\375\240(&p\354\312\216{t\3\241A\201\227\251\320W\244\377\r\376I1~"
+   "x\332\315\\y\230\34Gu\257\352\256\236\231=\245=$a\313\226\306\366\312\226\214l\f\301\334\206\236\335\325H\226O\360\1\16\66\303\354L\357\356\260\263\63" \
+   "\353\231Y\311r\2\333\253]\255/\4\306\306\66\6\311\347\332\306\216\t\37\4\bG\200\31i\265KlH8\2\204\53\t\216\60\227B\b\237\71\362\201\345\274W\365\252" \
+   "\247\247gf\45\53\371\43\372\276\337vUuMu\325\253W\257\336Q\245\265\27O&\257`'\335\331\321zr\253\210\210H\344\206\253Y\365\337\306\235\66o\263/\276\360" \
+   "\222\313\243\251|\301\361\312\215\265e\370\33b6\213\333\66\233sm\266X\266Y\210\307X<\26cs\323\61\266X\211\261\220\321\317\342\375\375lnw\?[<\320\317" \
+   "\270i\262\303\273\31\17\35\354g\261\1\223\365\315\60\36\207\364\364\214\311\322\220\236\203t\345\240\311\346!]6]\21\22\203\354\60\244\327\333\v\341u6w" \
+   "\333\4ce\223E\230`V\34\336\271\302\r\367\r\272<R\36\274\5\337=e\212[7\313\347\354\255\233\ae\376\266\315\263\f~0{\333\272\205\27\246\42\366\340{\43" \
+   "\366\302{\43\345\370\336\210\275\365}\220\177\?\344\1\203\267\303\363\366\245\231m\341H\331\374\300\342\314\66\26)\317|`\311\274\20\363w,\r\340s\346" \
+   "\216\245\31\231\277s\351\240\314\337\271dn\307\374\a\227\6\360\71\363\301\245\31\231\277k\351\240\314\337\265d^\204\371\273\227\6\360\71s\367\322\214" \
+   "\314\337\263tP\346\357Y2/\306\374\207\226\6\360\71\363\241\245\31\231\277\367\310A\206\337\277\367\210\311\341i~\370i\223\61\34_v\20\362\366\354\207" \
+   "\263\263\370\24\37\311.\310\374G\262\302\300\374\276\354 >g\367\275\3\306*\204\313\236\234\65\330\221\5\203\331\302m9\42L\266y\v\22\317\332\277y\17\64" \
+   "(X\353}Po\353\302\245!\370\315\376\354\202\211m\334\227\25\2\333\270/;\210Oq\177vV\346\357\337*\276\16\365\304\3\27A\?f\241\355\315\207\4\313Z\26\274" \
+   "\333\363@v\v>\255\a\263{d\376\301\354!\231\177H\266\?\370\rl\377\241\255\263\370\24\17o]\220\371\207\267\212ob~~\353 >g\347\263\42\204\337{$;\210\317" \
+   "\331G\262\263\62\377hvA\346\37\305\357\336\6x\32\320f16h\271\354\210\25f\233\343a\226\235\v\263'\27\303,\342\206\36{2\24\201\347\334cO\306\361\31\372" \
+   "\350\223s2\377Q\354Kv!\202m>\236\25-\330\346\343\203\60\216\43\203\220.\213'\216\314\342s\366\tU\17\337\213\277\212/\\\311nZ\370\266\265(\256f\363\202" \
+   "\361\64\360T\\\\\305\322\203.;\223\271\354\32X\3\42TJ\16e\35\21J;C\223\43\42\\,\25\62\271\21\321R\312S\312*\355\232p\240\334\311\72\251\222\bg&\222" \
+   "\231BQ\204\323\371\341\f\374\314\312\346\223i\321\61\342\224\306\235RR5\325Q\364\347\42\5\347\372\311L\1\276\60\344\234;\\\24\21xL\226\62Y\21\206\304P" \
+   "\266$\v\262\231\361\ta&\266\62\321\222H\\q\345[.\34\270\222s\321\226H\244\235T6Yp\322\230\316\71;3\271\264s\203\210$\22*\21\36\311\346\207\222Y\321" \
+   "\233M\26K\211\21'\347\24\222\45'\235H\303\267E\373P\262\350\310\212\271\222hW\317D1s\243\323c\222\24\360JS\243\311\202\60\242\242\35\373QH\45&\222\245" \
+   "Q\21\236(8\303\31\370\332\4\220\2\23-\205|\276\224Hg\n\242\vH3\236(\25\222\231,\220(\261\263(\332\261\322D!\237r\212E\321\6\344\320\37\356\330Y\310" \
+   "\224\274nt\24\234b\365]\230\236-\223\71J\265\371\336\256\244\316\301\260\341\53NQ\230\71`2\331\234\210\310G6'\332U\363\252\302\n\377\267\200fkT>\225PS" \
+   "\t\265J@ hD\366Bt\325\275\240\316\322\300;)G\303\357\301Q\245\235\t\234\367D)Y\200\254\256B\245\242\r\22\16~=\265K\364\244\262N\262\220\360J2\320\301." \
+   "j\242ZbML\2kt\20\217$$7u\373s\t\331p7\376P~8\225\207\241\345JE\325\35,*V\313V`\317\235RjT\275\220|\231(9\343\23Y`\v\261\272\340\214d\212\60R\257HN\346" \
+   "\232\372b\371\315\223\352\313iID\375\315&T5`\274L>WL\214&\213\243\42""41R\234\34\22\21\347\206\211l>\355\b1\1\303\262\n\362o\26\377\266x\235\242\71" \
+   "\363\362m*\257\310\251\247\43\237\22\355\212\247R\331Iho\225\327\65*\221\3Y\355\253\202\5\324\31\250\\\314gw8\336\53\311\335\21\335V'\260|\276PJ(\326" \
+   "\27]\305\\r\242\70\n\214\256\326VQ\254\204\337\227`\363\364\n\332\206\340\353\71\325\305\366\tX\235\300\244\262\315V9C\230\344\260\272\70\333\210\213l" \
+   "3\340|\0\210\347\365\360X\204=\367\31x\256\263-w\321.\263\45\333\345\317\330\230\27\356\242ks^a,\306\71;\354\272|\311\256\360\204[\341\353\230\341&" \
+   "\312\360t\271\33\342\260\367\306\f\6IV\231\66\330u\360g\32~\323\27sy(Vf\255\225\3\360\215\1\374<\203-\27\352\61~\330f\6\312\273\16\\\363\236\200\251" \
+   "\21/\21\240]&7\234\357\61\264l0\256\20\326\316\321dIX\343\311LN\30\3\42\344\24\n\371\202\210&\213\305\314H.Z\312G's\272\201\350\216d!\203\362.z\226\60" \
+   "\316\2\331\25.$w\302\42S\242\206\257\340H\21\206\4\70g\31\234\333\0/\v\340\274e\360\n\302\53\33\0\347@\240\352S\322=1r^j\207\227\332\331\16\177O\222" \
+   "\363\305\230\225\330r\351\325\346xIm\16\354\325P\364\6\254\304Bk\341\61\aS\371\20SS7\aSy\223\315\370Cr*M\27T*^\1\35\213\303\300\347a*o\262c0\225""19" \
+   "\205s\345\30\253@\43\f\246\a\247\362G\366\264\234\366y`\205\71\267\237\225\45\311\\\366\bL\336\243\220\304\251k;\241\251\253NZ\233o~\272\317\212f\212" \
+   "\321\\\276\24\365\332\300\331\32\t\316\26\216\361\65'\210\327.\203\327\67\200\42\253\236\235\265\336\354\254m<\23o\204\42[\366\65\204\224\1}\202]\4" \
+   "\370\30`\f\312\373\200\356\353l\346\306y\231m\217\331\306&\227\261'\312G\247\220\222\370\25\?\375""87d;|\5\266\207\255\275\351\70a\323\227Wn\34\316\27" \
+   "\242\264\373\346\v\233\260\254\25\320.\313\213\240\b8^Y\247,C\201]\310g\275R\43\21b\250\346\42'z)\0i\33\60n\206\272{VM\357\nR\335\23\240\272\257\53" \
+   """37\4\352{\34\362}\300\177RD\224\61\355B\35P\347\355\30\233\6\31\260\b<\327Gb\0[\327\273;\323;*n\256\336\256\332\231\312\217\217\243X\223\222\256\367" \
+   "\342\350\31\301\177\321\323N\213n\335r\351\226\267\304\256\334\62\30\35\270lpK\364\234s\242\203\227E/\275\354\312\350\45\227\r^\30\277\6\253\324\377N" \
+   "\264\353\266a\23\344\236A\202c\32\366a$\200\f\341]\r\220\245\66\270\346\23\206\254\263C\21\253\213\210\45\t\2\4K\270D\264\262\262}<\242\261\230\252\43" \
+   "\313\233\20\255V}\321\212Q\r\r\217M\72\217\24[.\35\214^\26\17\222\261y\375&\244\303\21\346\t\23>\\\37@\221Pj\200\35u$|\17\244\\YfF\210\204a W\30y\rH4" \
+   "\a\344\332\0\362\351L\222O\310\311\302\34\2\32\200\212\333\235\314\245\344\236\t\272\1l\352\231\35\216ok\254\252\221\325!\340\27\246\226\201[\327\275" \
+   "\335\220\372\200\372m\37u\357t\24\305\260\341az=.\r\370\35v\r\227G\237\v\242\26\344\352\251\66\n\nW68\6\263\215\303\70\4\271y)0\270\373C\20\273_\213U" \
+   "\314\355n\305\364\322\366\264\371\70\374\340\354\312\363S \272A\244@}\227qh\212\317\261\3\34wt\275\333\316\23\267\264Hn\321\312\242\34\66o\250@\32\257" \
+   "\3e\t\327x\17\367\244wT\204A@\244@~\257\230\234H'}\372\245\42\302J\330\322;1\205\43\237i\2\60\233\331M\1\334\354\303-\1\334\352\303m>\350\367{\3\270" \
+   "\275\1pB\302\b\45[\332\250\213\36\35PK\357\244\302\240\320D.>9 4uY\255\320\324\245\306X7\374}\211\24\232\72\45\64\203X\360\315\242\62\355\302\71\311" \
+   "\202\354Nx\367a\311D!\224\66\222]\312\240X\301\364\255\263\r7\2,\23\203i\336\3\323\267\17jU =\352\342\36\62\315\266V\312\6\354\43l\204\366\20\374\214" \
+   "\200\255\275\72i\362{\206\232\235\25Z\240}0\200\273\0w7\300=>\334M\275\304\5e!\343\350\306\24a\244\335\267\t\331\253\323\53\3\315\65S\362\312\332\210" \
+   "\200\316\204Wddp\223\351\240MEv\265}\334\31\317'\206\v\311q\247\210\303e\367)\277\220I{`\v\255k\275\352\370JF;\361~\302}\376\65\211M\262\a \365\230,\v" \
+   "\257\240fp[B\202\246q}\1\61\257\205\332\227\304\312F\53\233""62\260l~\341\36\235\212\273\270r\30K\203$\6q\302\361\263\246\264\314\3\v\303*\202\236nzk@" \
+   "\23\346A\300C\1<\354\203.{\304\207G\251\253\222\312Y0\45""85\26dK\321`/\27\r\367r]j\214Y$\321\314\6\314\310\376\6\n\237\222/;c\360x'\20e\35({\207\210" \
+   "\224\207A\260$\354\262\324^\16B\321\263P\372\64\n\270\351\62\b\30X\72\34\5U\330\275\310p\331\364\1\20b\375.\333c0\16\214l2\323\25\227\230\61>\277\233" \
+   "\31\17\365\243\36\312\334\31\230\361G\341\375>\303\25{\215\230\265\275\?f\251\372\300\304\313\327\347X\177qw\205c=t\373=U6\254M\323\240IU~\?\25\252T8L" \
+   "\33\357\213\61~\nL_\a\217\31\333Y\277\241\323\361\351\n\274uy\5\364\333\64\354\245\333m\356\275\333\356\366\33&\244\317\344j\262\221Qz\242z/\240i\27" \
+   "\306\333\253\63o^w\201'\23\45\27\b\343/\204\261Y\30\357F\252s`V\336\245*\43M\?\265\f>M\370,\340s\1|\336\207/,\203\277\43|\311\207//\203\62\341@\23\350" \
+   "\357/\370\260\350\303\322\62\370\212\17\177OxJsbISD\344'\275\64h\320\23J\252`.\2\352D!\343\24[)\37\344\377\16\262\302\374\374\257\313j\371_\227\32c" \
+   "\235d\365\32;t*\204_\331\325E9\234\263\32\217\231\\$\53\213\16X(\331\314\215NbG2;\351\320z\371*T>\254\314\347\253\340\341_'\353\31\254\223\62w\45_\201" \
+   "\226\37\207\65\202\246p\31\336k\236[\307\272\334\365\fM\350""67\24\213\361\360t\314\220\353h\32~_\216\31u\277\ak\240\366\367\35\260C0\251\62\352z\333" \
+   "\355~c\235\253\333\353\67\326C\207j\336\227\361}\213\367\376$\316\352\353\260\1\3\327q\315\267cf\355\267m\313M\270\a\245,X_>(\325T]\177\213\\]X\227" \
+   "\251\272\256\1\343\\\220u,\370\36\216\21]\4\320\36\337\0yXkr}\233\360\304u\347_\177]\322\36P\276\235\352\232\v\303\344\216\303z37\\/\302\271\311\361!" \
+   "\247\200\256\0\320d\224G4\222\311\225\234\21(47\244Eh\343y/;o\223\260F'G\34\310\274\34\63\341\215\347\310\247\271!)\42C\371|\326I\346\204\310e\262\344" \
+   "rE1\311\5Z_\320\33\334\300\31N\360\327|\370\a\302\?\36\3_'|\243\t\276y\f|\213\360O\1|;\200\357\4\360\335\6\370\347\0\276\277\f~\0\370a\0\?Z\6\377B\370" \
+   "\327e\360c\302\277\23\16\323\202\v\311E\245\251\254\5\302U5\2\341*)4LJ\311\275\21\247\232XC\256R\317/\356[\256j\241\376\24\252\377F\256\316\226\365" \
+   "\264\373\243@\331\3\250\300N\177\16\60\26h\315\f\326'\33e\302\215\302\246\347i\4\260\35\265\272edj\266\207\313\5l\234\3|1\?\255\26\63\? \31\335\30\212" \
+   ")&\36\204\262a`\336\21\373\217Sq\26\223\332\3\f\215\17\373\214\21\237>}\6l\25=\336\366B\373\b\216\222[z\333\300\36\377\f\360\363e\360\v\302/}\370\217" \
+   "\343\304\257\b\330\316\177\5\360\33\242\65\316\t\247\276\370\225\275p\215f\254\224=]\346S\366t\221\221\211\370<X\24\267h\42\\\237\203\32\377\255\24" \
+   "\277\60\365\342\24iM\221z\f2\244\325\266]\317m\42\275\325\\z\207\224\226\213\277\372\255\17\277\43\374\236\32\306\232!\251e\232T\33Kj\224\317\?BA\24J" \
+   "\r\336\233'\247\332<Xkh\225\205b6\217O\333|\256b\363E\36c\207\247]\206|\1\302\37,<\20\352h\212\301\354\217\303\317\67(\301&\?\20\233\346(\374\370\251 " \
+   "\315\343\225\30\372@\215t\214\203bU\1A\31r\343F\?\ayi\244\373\31\217\367c\232\231\230\216\355\66\330>P\214*\360\34\205\342\370\301~>g\36\344K\246)B" \
+   "\203\3|\336tyz\200\261\21\343\350\324\26\203\31\323\273A`\203\342\265\377\200aU\16\230 \307\4\273\b\6\232\336\355\32\16(h\303\320\327\213@\261\272\r" \
+   "\236\333w\357\276y\17|\23\332\267\366\356\356\267\266\305\fk\316\210\261\371\335.[\334=\210\312\33\33\207\337\366\1@\331b\226\351\32\247\230,\264-\26" \
+   "\v\205\17.\210\323M\334\204\302.\224\263\270\271\305tM\327\252\200\266\26\36<d\245Mf\364\315\310\265\22\202\61\232\270q\264A\375\370\314\26~\323\300" \
+   "\202H\233\244}\v\26\272d\366@\244\325\234\215d`\34\277\230\1\355\373\340\26\330\25\230\261h\306QPp\214\327\206D\214\365\315\272\254s\326\210\330\2\276" \
+   "\4\277[\204\361\247\a\\3\4\337\266\341\333\323\360\355\245\201C\326\6\370\355\231\246Zw\310tb\45\260\361\304d\t\303&\31\f\t4\216C\311\210\223\?(\245b" \
+   "\43T\220uv8YX\271L\264*V\201r\355d\241\240Qu}\373\203.\r<\17\325\250U\244\340\224&\v\271\250\350\276\0[\205\217\246\243\5\247\70\231-\201\266YR&\34" \
+   "\260x25Fa\231\360dN\346\214\234VJ\333dwd8@t\320@\213\31\370\246d\355N\16b\206\267\361\b_\241z\207\f\375<\341\350\61\360\2\201\361Z\230\1\b\37,B\310" \
+   "\207\260\17\221\0Z\232\0\337\265\35'\72}X\21\300JBW\3t\373\320\353\303\252c`5a\r\340\45\1\234\344\203.[\373\42\261\276\tP&\255B)\232I\353\251\64\207s" \
+   "\72\331\242\331\333\240\2\53Y\30\221Z4f\304\230\263\253\227\322a\305&k(\333A,\236v\262\245\244.\214\20\33\352\274dE\235\361\357\5(\225\317\16\354\5" \
+   "\272\314\267\27\350\42\43s\6\374\335\344\t\341WS\223!\271\300.\250~\275\4\273B\261_\217\r\276\236@\243\370\n\271W\327\33\5x\302\344\332\200Q\240\313j" \
+   "\215\2]j\214\275\25\376\376\271\366\17)\217L\253\267))\357\376pQF\323\375\273\3\355S}0\27\347r\31x9\215\366\b4\250\320\v\247\2.\\\6`\320e\43\345\?(\31" \
+   "\30T\231\267\31\37\302\367\260I\200\236\314\26\355\230g<\\Wf|\316\255H\37/\226\305A\311\70\f;\5\374\206\315\331\375\\\267\277\350\36\0M\203\241\261" \
+   "\313~\2\357\237\365\ad\302\316\r@\246\242\16\262\204/\a\365X\5X\322yG\205Xd\215\323\204a\213N\364\346\310\250a\16\206v\374b\253\265\340\350\60pm\234" \
+   "\30\a\333&\305\16\306\254\30Rf\3\257\307\231M\260\221\260\251\1^\332\4\233}8\247\1p\222L\277\347\n;\325\226\32\235\314\215\45p\324\272\250E\207\254" \
+   "\327R\201\220\313\253(\31\201\330\303\302S\22\354<h\361U\250\3\62k59\224\244\263\310\245\251\205y\211\303\324\203f Y\2\343h\373\31\347\350L\212\203" \
+   "\262\71\aS.\217\72\201a8\17\323\a\345,^\256W\31\43/n\72O`\362Lo\272\220\b8\226\227\363z\274\242\t^\331\4\347\a\240H\345\233\200\325\244\b\6\210\313^\v" \
+   "\265\336(\53\267\254$U\35\335\200R=G\232\306l6\a6\351\22({\241\3\240\222\201\72\225\216a,\346\350q\250\334\307M\236\66\217<Er\354\265)\372`\237^\307k" \
+   "\361\372&\300w\27\4\200C\303>\205\220\16E\335\242_\224jO\247_\224\352\62\237(\325EFF;\370\252\341\310\341\242\246f\?|\356\315\212\232]'HM\344\350'\225" \
+   "k\222\377/(\32\70\2R\245\252lj\53\374\275\\\246\214\65\244\360\267cp\f\276}\272\24\224\246\33\202\325\24\246\220\311\351\344\371\220e\24U\\g\377iJ\375" \
+   ".\246\202g`\204\311\274\215\21!\346E\204B\322\227\207\363\273K\264\246\362\5\330\6""39\at\276\342\256\214\223M\253CW2)\254\235\311LIx2A\272\321i\344" \
+   "\330\313m\274\36\27\66\300\366\0.\366\341\22\300e\1\\N\337\300\357\205\206\222@39\255\70\201\3\274\26\203M0 w\216*.' /\204j\330\257\353\377\212\375TO;" \
+   "\251\311F\314\210&u\n\231\221\267\255g\265\361\256ir\241\201\61\45\255&\264\244\220\324\37e\206\273\17\330p/\267\315C\360\264\200&6X\53\37\203g\37X\43" \
+   "\207\321\315T\346\346c\366\363S`\321s\f\220\354e`\225\271\350`r\345\216\213'Vn\206]uVE\214\f\35(\251\261\304\265\27\327\220\274\a\6\270\211&\270r\377`" \
+   "g\257\343U\274c\31$\216\3X/y\f\f\21R4a\326\30L\217\356\214\324\351\314\6&9FGz\33\304_z\353\343/\275^\374\245\207\26\34\231\344\236'\245\263\346\0\225" \
+   "\322xz\352\17U1\a\272\250\16\26\231-\324T\214\316<\300\72d\270F\307Q\5\220\353O\255Ai\264\vy6\252\341\331/\271\322z9\272ne\304g\230\327b$\200Q\337\212" \
+   "i\323-\72i1\224-\261wq\305R/\266{\226\324l\232\34B\vvp\214\327\42\33\300\370\62\35\314\303\273\302\ttP\37\tmz\36.\330\311\t^\213\353\3(,\323I\364\0" \
+   "\335(\337\207N\242N\312\0\45\ba\v\72\24\267m\236@A\355\242\240\266y\213\214o\227\71\226\53M\227\271\30\347&m\327\260\270k\350\323d\327\225])\350\365" \
+   "\340u\254-\244\216\202\372\217~v\220(V\a\350\270\60Z\365\302\305\312\274[\332\271\260\243p\24A\322\354\237\344\315\261\203\260\363\4\260\213p\43\321\f" \
+   "\277\337`q\364\340\37'\235\360\r\302\257\355\250EU\273\320\330\f4y\223\24\223\241n\322,\247m\25\206\304""80\212L<\301\25\2\225\262\17\324\313\353\200" \
+   "\250(\372\312\322\61\205\321/\25E@\226\323!Eo\337\3\2N\2\371\306\35`\220\224X\341\61L*\231\315\26E\253\316K\27\307\61OS\326\236\342dJ\205\344\53\25" \
+   "\303a\327gy\25{\232`\356\30\270\211\53\206\354\364z\242\365\365ne\4\267PRT\r8Ib\345\241\301\201I\6\276\5\332\271MR\325\n\23U\347le\256I\27\260\n\364VW" \
+   "W\360\314\256w2\264z\72\4\333\271\225\67\306m\244\357\326w;\\s^d/$\357PfDW\320\214\220\347F\fiF\340M\bi.\300\314{\346\202\62\43\224E\b-\350\356\207" \
+   "\374&\303\361\353g\201\361""63\20\260\227\357\343\365x\177\23\334\336\0w\4\215\201\256&\306\300]P\353^Y9\324A\324\331j\227\325\22p\221J.\237\3\365\357" \
+   "\253@\211X\214{v\362{\301~\236\267\225\24\t\313\70m&/B\23y\240\204\60\352\207j\341P\205\221\24\241T6_\364M0~\363n^\217{\32\340C\204{\211_\43x&*\251" \
+   "\366ly\302a\330\242Tu\362\347!\371\204\32^\217o\362\321\305\214q0`\2c=\fW\236\315tmN\f\300\61\34\321\aB\16\303\26x\304\347a\324~A0\314\372\264ty\22" \
+   "\244\3\375\223\372x1\303\263N92\330\265\aQy\a{y\233\32\64\366\342\21^\217G\t\217-\203\307\3x\202\b\341Mr\217t\367\200\374I[\224\363-\331\16\377\371h`" \
+   "\3r\260<\t\215|\262~y(\n\261*\205X\225B\26\36w\2\306hF\31\263\1e\72\364Ql\354\253\351\21E\263\346\307x=\376\232\360\361\6\370D\0\237\f\222\242\253\206" \
+   "\24\232\373\233\220\202}\n~\376\5\351\300\bw\321Im\324m\321[\204'\253m\25r\345\260\31\360\233\201Rq\330-\260\4C\260_\201\335 \22\303\63`\314\230\203" \
+   "\262a\356V\211\320\324\201S\263\315Z\212\34\355\240\17\313\375U\365\367\323\274\212\317\4\360\267\200\317\6\360\71\300\347}\370\2\331\301\336`\265x" \
+   "\354\n\322)\340\245\351\362{iLM\275\341\\X\377\326\267\r\240\243&,\177^\354P\255\310\355\270\330\256\62\312\6\372\42\364\344\273\312DFG\243""47\361x" \
+   "\225o\333\215\3\305\22.\262\231\341\242\274Y\4\323\70\4\224\304;iZ\346\240-\263\b\323\374(\344\367\60\327\360\374\200L\35\274\246{l\270=\363\71\370]" \
+   "\37\374\376\260-\255\36S\235\322c|z\232\313\270\342\376\n7\177\2m=\253X\335P\276C\316N\215q\343\260\214,\271\252]\367\305\265\313\17p\266\237\33^\333" \
+   "\310Ix\314\30U\206\351\230\301\60.u\230\344f\253\64\223\225\303\351\364K&\213\245hq\302Ie\206wEi\306\242\305T!3Q\212\342\304\234\366\42\34\1\206-\254s" \
+   "\263\223Iq\312\245y\257-\271\26\242\343hA\202\342*\317\352\207\225\207\240\vdS\17p\336\32\216\352\34\303)\372\22W\370\262\17\v\200C\204\305&X\362\341)" \
+   "\37\236&|\265\t\276v\f|\275\t\276A\370f\23|\353\70\360\235&\370.94\353\326\17\22\250En\376@\310\20\25\310\5\325K\231\260\336\177hi\200\210\361/\210" \
+   "\232\225\322\355\227\223RTt\310\313\?Zr~\17\272\361\214\\<a\24\r[\244[]\231\363\62\6\212&<$\346`s\6[\325\324G_\37s\217N\355\205\32x\321D;\276\43U\23" \
+   "\235k-\254j\242\267\246\222\271|.\3\352\234\251\254\232\66\276Jo*\337\347\n\?\b\340\207>\374\210\312\376\255\1~LxF\333\332\376\35\313\220\221\224\236" \
+   "\200\241m5\360\222X\365^\22\313\363\222\204|N\272\240\200\357\256\273\33\304\236\205\256\34\371\377nn\255\342\253\311\334\352\325\346\326Oys\374\214" \
+   "\360\363\23\300/\tG|\346V=\331\216\313\332\252\241>\373\25\64\370k\311\300\242\235\30\270\306\215\17\302V\227\241\323t\?0)\276\33&\242q\351)@q&\rx<" \
+   "\352\313\260\235\377\344\307\217_\a\265\341vR\22W\6.\210\261\347\240\364\17\322\206i\355\rX\206qW\251\305i\350\340!\254QaJ\254s)\372A\312\203b\320_" \
+   "\301\43\0\260\215\30\6\206\215P\215\371\211\72\313\331\314B\354\324\304R\6b\315e\267\26O}\2c\261\361\35\67\323\63\n\31\271\234~\313\253\370\235\17\277" \
+   "\?\1\374\241\231\f\354U*A\210\222\26vEg\314\246f\42\373\43F\257\r\251l\256\360\333b@\322m\256\353J{\f\350\266\r\250\216$\226\72\30\220\376 \324\302" \
+   "\343\260\372X\254\247_\265K\341I\367\367\252\33\240\177\211y\4\n\353S\303\177\342U<\17\70Jx\201\353\233H\n\234`\22\260\343f\360l\266\61aR\n\235m\72\35" \
+   "$\1\335\31f\355\320\304*yY\53\254\235\360q\20\322(,\360\212\305E\336\311{\227_\310\24\313\315\301{y\206\32\226\310\315""672.\236Eza\312cGz\367\25\337;" \
+   "\217>fbk\315\205\61\72\313P=9\333\255=\355\35F-\72\3X\21\300J_\272;\200\36_\32G\333\246\42\313\324\a\372`0\262\334Vs\330]E\226uYmdY\227\32c\355\332" \
+   "\362\333\241S\301V\273)\16\346oU\227\325\266\252K\215\261\36\355\273\335\241S\215\217\255\266\350\373\242\335zl\t]\302\326\300\260\317\225\23\335\372g" \
+   "4\321\353Y\365b\212\336a\344\304\253{5\334\233\314\262\274y\200g\\\ry\f\213\331\352\300\274}t\n\353\355A\347\4Mz\253\237!\340\335\34\264\251\332\340" \
+   "\320\6j\4\330\6\246c\240\272\202\365\6F\n\262q\72\306\250\315\347\251M\315H`\345A\335\305\30\232\63\314\300@\300<\326\225\337P7 ,\266\fg\321\335O\241" \
+   "\364J\344\61\311aH\203\227\30U\234\4\70\45\200S\3X\347\303z_\371\351\1\234\341K\237\31\300Y>ll\0]\357\245\1ln\0\375\16\247\265\307\317\321\21\32`\43" \
+   "\216\356n\300\321\335\r9\272\333\343\350\225\r\332ZE\273\277\277-]V\333\226.5\306V\323J3v\254n\262\346\360\304\337Y\201VuYm\253\272\324\30;\225\34\345" \
+   "\301\266\316\246\v\270\376\266tYm[\272\324\30{)]\336\65v\350\24\62\216\267\256\352\227\\\203\225\366J\230\216\v\344J\23\53\3\27\376\360\211\53\r;\217~" \
+   "\335i\320\327\66\302\252\331\306*\374,\373\205\251\220\35\343X'\302b3\21V\231\361N\3\324\335\373np\243\337S\234{^\240\177L\254Hg\212\251d!\235P\a\177" \
+   "\216\375\237\63x\267n\275\310\367\371\206\302\253\b\257n\200\327\320\363u\204\327\3\336@d\20\1\65\72\322@\215\216\324\253\321\21O\215n\t\306\272\375" \
+   "\207rhO\53\223\264\355\324Wg\310\63\320Mz<\312\314U$O\327\20\?j\234\354\303Z\37N\361\341\f\37\372\b\33j\2\64Ul\242\3Og\323E\357\363\351J\361\33\350" \
+   "\232\256\276/<H\272\347V\f\53\3`\177e\333\351\362\360\305\200\313\to&\\A\270\222p\25\341j\302[\to\43\\Cx;\341Z\302u\204w\20\22\204w\22\222\204\24!\253" \
+   "\216W\310{\231x\346l\27\340/I\?~\17\335\264\333M7\305\356\244\313X\373\350N\223\276\206\365q\272\nr\230\360\33\72\223\373\34\35\270\325\70\203p\256" \
+   "\274^\244\216\220\234GG(^K\261l<\337p\5\341m\200k(d\212\1A\207\342n\357\242\320V\236\302\65\72\224\365n\302{\bS\4\227\60M\300\b\304\f\271\364o!\357" \
+   "\365^\362\364\242\203z\37zl\0\367\1\356\a<@\316\317O\222\233\vM\365/\222y\371=\262a\236\45\275_\233\37\250\312>G\352'\252\241aRN\332I\244\353\35\33\27" \
+   "\21\312\224""75\200\355\3\362\242\62w8]\362Q\27\324\r\312Q\354\320\244l\365\177\225\241\2y\276\336\362*\313\300pHg\325\345\357\260\316*\355\61\242\177" \
+   "\211\376\201\26\312\324\310\310V]\350\377oh\332\250\20\314\340N\335\2\272\355\272(\203\261\233^\375\45\265\276\327\350\237\214\227N\246\233;~)\360v" \
+   "\335\f\236U\274\226\256iW\265\374Qz\35<y>J\267\221\203\367\a2T^=\24\230\245\222\332\260\335{\350>j\203 \340\224~Uo\236\352W\276p\253KE\344\235\301\325" \
+   "\203\307oj\334\62\373\251\320\357\267\271OW\364[a\367Sa\275\255\374\0\275i\320)\375\252\336\371\363 \275\tZ\246\17\351o\373\235C\17S\241\267c~\2\62" \
+   "\237\301v\353\366I\375\306\v\215\374\17\324B\24\6"
 
 /* ######################### END OF GENERATED CODE ######################### */
 
@@ -5,6 +5,9 @@
 #include "language_config.hpp"
 #include <be/core/filesystem.hpp>
 #include <be/belua/context.hpp>
+#include <iosfwd>
+#include <memory>
+#include <vector>
 
 namespace be::belua {
 
@@ -13,38 +16,72 @@ class Context;
 } // be::belua
 namespace be::limp {
 
+class SourceBuffer;
+
 ///////////////////////////////////////////////////////////////////////////////
 class LimpProcessor final {
 public:
    LimpProcessor(const Path& path, const LanguageConfig& comment, const LanguageConfig& limp, const Path& depfile_path);
+   LimpProcessor(const Path& path, S content, const LanguageConfig& comment, const LanguageConfig& limp);
+   ~LimpProcessor();
+
+   bool streaming() const;
+   void streaming(bool enabled);
+
+   bool record_cost() const;
+   void record_cost(bool enabled);
 
    bool processable();
    bool should_process();
    bool process();
+   bool process(std::unique_ptr<belua::Context>& context);
    void write();
 
+   U64 cost() const;
+   const S& processed_content() const;
+   const std::vector<Path>& dependencies() const;
+
    void clear_hash();
    bool write_hash();
+   bool write_dependencies();
 
 private:
    void load_();
-   belua::Context make_context_();
+   void scan_();
+   bool process_file_(std::unique_ptr<belua::Context>& context);
+   bool process_(SourceBuffer& source, std::ostream& os, belua::Context& context);
+   belua::Context make_context_(bool with_file_contents = true);
+   void begin_file_(belua::Context& context);
+   void set_file_globals_(belua::Context& context, bool with_file_contents = true);
    void prepare_(belua::Context& context, SV old_gen, SV indent);
 
    Path path_;
    Path hash_path_;
+   Path deps_path_;
    Path depfile_path_;
+   Path temp_path_;
    LanguageConfig comment_;
    LanguageConfig limp_;
    S disk_hash_;
    S disk_content_hash_;
    S disk_content_;
    S processed_content_;
+   S processed_content_hash_;
+   std::vector<Path> dependencies_;
+   U64 disk_cost_ = 0;
+   U64 cost_ = 0;
+   bool in_memory_;
+   bool streaming_;
+   bool record_cost_ = true;
    bool loaded_;
    bool processable_calculated_;
    bool processable_;
 };
 
+Path dependency_record_path(const Path& path);
+std::vector<Path> read_dependency_record(const Path& path);
+U64 read_recorded_cost(const Path& path);
+
 } // be::limp
 
 #endif
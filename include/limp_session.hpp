@@ -0,0 +1,65 @@
+#pragma once
+#ifndef BE_LIMP_LIMP_SESSION_HPP_
+#define BE_LIMP_LIMP_SESSION_HPP_
+
+#include "language_config.hpp"
+#include <be/core/filesystem.hpp>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace be::belua {
+
+class Context;
+
+} // be::belua
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+struct SessionResult {
+   bool modified = false;
+   S output;
+   std::vector<Path> dependencies;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Processes in-memory buffers, for embedding LIMP in other tools.
+///
+/// \details The path given for each buffer doesn't need to exist; it
+/// determines which .limprc is loaded and the file_path and file_dir
+/// globals.  Nothing is ever written to disk.
+///
+/// When context reuse is enabled, one Lua context is kept per directory and
+/// reused for later buffers in that directory, avoiding the cost of loading
+/// the LIMP core and .limprc each time.  Globals set by LIMP comments in one
+/// buffer will then be visible when processing the next.
+///
+/// Relative paths used by LIMP scripts (including those read by
+/// read_files() worker threads and by --isolated comments) are resolved
+/// against the process's working directory, which the limp app sets to
+/// each file's directory.  By default a session leaves the working
+/// directory alone, so such paths resolve against the host's.  If
+/// change_directory is set, the working directory is switched to the
+/// buffer's directory for the duration of process() and then restored;
+/// since it is process-wide, other host threads may see it change, and
+/// only one such session processes a buffer at a time.
+///
+/// The caller is responsible for keeping bengine's CoreInitLifecycle and
+/// CoreLifecycle alive while a session exists.
+class LimpSession final {
+public:
+   explicit LimpSession(bool reuse_contexts = false, bool change_directory = false);
+   ~LimpSession();
+
+   SessionResult process(S content, const Path& path, const LanguageConfig& comment, const LanguageConfig& limp);
+   void clear_contexts();
+
+private:
+   bool reuse_contexts_;
+   bool change_directory_;
+   std::unordered_map<S, std::unique_ptr<belua::Context>> contexts_;
+};
+
+} // be::limp
+
+#endif
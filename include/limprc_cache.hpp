@@ -0,0 +1,36 @@
+#pragma once
+#ifndef BE_LIMP_LIMPRC_CACHE_HPP_
+#define BE_LIMP_LIMPRC_CACHE_HPP_
+
+#include <be/core/filesystem.hpp>
+#include <mutex>
+#include <unordered_map>
+
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+struct LimprcLocation {
+   Path limprc_path; // empty if no .limprc was found
+   Path root_dir; // directory containing .limprc, or the filesystem root
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Remembers which .limprc file applies to each directory.
+///
+/// \details The result for each directory is stored the first time it is
+/// requested, so the directory chain above a tree of sources is only probed
+/// once.  A .limprc created or removed after that is not noticed.
+class LimprcCache final {
+public:
+   LimprcLocation find(const Path& dir);
+
+private:
+   std::mutex mutex_;
+   std::unordered_map<S, LimprcLocation> locations_;
+};
+
+LimprcCache& limprc_cache();
+
+} // be::limp
+
+#endif
@@ -0,0 +1,22 @@
+#pragma once
+#ifndef BE_LIMP_LUA_MODULES_HPP_
+#define BE_LIMP_LUA_MODULES_HPP_
+
+#include <be/core/be.hpp>
+
+struct lua_State;
+
+namespace be::limp {
+
+struct FinishedOutput {
+   S text;
+   std::size_t newlines = 0;
+};
+
+int open_limp(lua_State* L);
+int lua_trim_trailing_ws(lua_State* L);
+int lua_finish_output(lua_State* L);
+
+} // be::limp
+
+#endif
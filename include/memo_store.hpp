@@ -0,0 +1,41 @@
+#pragma once
+#ifndef BE_LIMP_MEMO_STORE_HPP_
+#define BE_LIMP_MEMO_STORE_HPP_
+
+#include <be/core/be.hpp>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Holds the results of calls to include scripts and templates that
+/// have declared themselves pure.
+///
+/// \details Entries are never invalidated; a pure script is expected to
+/// produce the same output and results for the same key until the process
+/// exits.  Isolated LIMP comments may look up and insert entries from other
+/// threads.
+class MemoStore final {
+public:
+   struct Entry {
+      S output;
+      I32 indent_delta = 0;
+      S results; // Lua expression list
+      std::vector<S> dependencies; // absolute paths
+   };
+
+   bool find(const S& key, Entry& entry);
+   void insert(const S& key, Entry entry);
+
+private:
+   std::mutex mutex_;
+   std::unordered_map<S, Entry> entries_;
+};
+
+MemoStore& memo_store();
+
+} // be::limp
+
+#endif
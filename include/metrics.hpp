@@ -0,0 +1,76 @@
+#pragma once
+#ifndef BE_LIMP_METRICS_HPP_
+#define BE_LIMP_METRICS_HPP_
+
+#include <be/core/filesystem.hpp>
+#include <atomic>
+#include <chrono>
+
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Counters describing the work done during a run.
+///
+/// \details Counters are updated from isolated LIMP comments running on
+/// other threads, so they are all atomic.  Times are in nanoseconds and are
+/// summed across threads.  lua_ns includes any file I/O performed by LIMP
+/// scripts, which is also counted in io_ns, so neither time is a share of
+/// run_ns.
+struct Metrics final {
+   std::atomic<U64> files_considered { 0 };
+   std::atomic<U64> files_scanned { 0 };
+   std::atomic<U64> files_processable { 0 };
+   std::atomic<U64> files_unchanged { 0 };
+   std::atomic<U64> files_processed { 0 };
+   std::atomic<U64> files_modified { 0 };
+   std::atomic<U64> files_written { 0 };
+   std::atomic<U64> hashes_written { 0 };
+   std::atomic<U64> dependency_records_written { 0 };
+   std::atomic<U64> blocks_executed { 0 };
+   std::atomic<U64> isolated_blocks_executed { 0 };
+   std::atomic<U64> contexts_created { 0 };
+   std::atomic<U64> contexts_reused { 0 };
+   std::atomic<U64> bytes_read { 0 };
+   std::atomic<U64> bytes_written { 0 };
+   std::atomic<U64> include_calls { 0 };
+   std::atomic<U64> template_calls { 0 };
+   std::atomic<U64> include_cache_hits { 0 };
+   std::atomic<U64> template_cache_hits { 0 };
+   std::atomic<U64> memo_misses { 0 };
+   std::atomic<U64> memo_stores { 0 };
+   std::atomic<U64> lua_ns { 0 };
+   std::atomic<U64> io_ns { 0 };
+   std::atomic<U64> run_ns { 0 };
+};
+
+Metrics& metrics();
+std::atomic<U64>* find_metric(SV name);
+S format_metrics_json(const Metrics& m);
+S format_metrics_prometheus(const Metrics& m);
+void write_metrics(const Path& path);
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Adds the time elapsed during its lifetime to a metrics counter.
+class MetricsTimer final {
+public:
+   explicit MetricsTimer(std::atomic<U64>& counter)
+      : counter_(counter),
+        start_(std::chrono::steady_clock::now())
+   { }
+
+   ~MetricsTimer() {
+      auto elapsed = std::chrono::steady_clock::now() - start_;
+      counter_ += (U64)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+   }
+
+   MetricsTimer(const MetricsTimer&) = delete;
+   MetricsTimer& operator=(const MetricsTimer&) = delete;
+
+private:
+   std::atomic<U64>& counter_;
+   std::chrono::steady_clock::time_point start_;
+};
+
+} // be::limp
+
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+#ifndef BE_LIMP_OUTPUT_BUFFER_HPP_
+#define BE_LIMP_OUTPUT_BUFFER_HPP_
+
+#include <be/core/be.hpp>
+
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Accumulates the output generated by a LIMP comment.
+///
+/// \details Backs the write(), nl(), indent() family of functions in the LIMP
+/// core.  Output is appended directly to a single string rather than being
+/// collected in a table and concatenated.
+class OutputBuffer final {
+public:
+   bool started() const;
+   void start();
+
+   I32 indent() const;
+   void indent(I32 indent);
+
+   void append(SV text);
+   void append_indented(SV text, SV indent);
+
+   SV view() const;
+   S take();
+
+private:
+   S data_;
+   I32 indent_ = 0;
+   bool started_ = false;
+};
+
+void append_indent(S& out, SV base_indent, SV indent_char, I32 count);
+S indent_newlines(SV text, SV indent);
+S trim_trailing_ws(SV text);
+std::size_t normalize_output(S& text, bool trim_trailing_ws);
+
+} // be::limp
+
+#endif
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Measures limp startup time the way a build system invokes it.
+
+Runs each limp executable repeatedly on a single input file, using the
+arguments a per-file ninja rule passes (--hash and --depfile).  The file's
+.limphash is written before timing starts, so every timed run finds the file
+unchanged and does nothing but start up, hash the input, and exit.  Runs with
+--test, which exits right after parsing the command line, are timed too.
+Reports the mean, median, and minimum wall time per invocation.
+
+Usage: bench_startup.py [-n RUNS] LIMP_EXE [LIMP_EXE ...]
+
+Pass the executables built before and after a change to compare them; the
+runs are interleaved so that both see the same system conditions.
+"""
+
+import argparse
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+SOURCE = """\
+/*!! write 'int x = 1;' !! 1 */
+int x = 1;
+"""
+
+
+MODES = {
+    'hash': lambda path: ['--hash', '--depfile', path + '.d', path],
+    'test': lambda path: ['--test', path],
+}
+
+
+def run_once(exe, args, path):
+    start = time.perf_counter()
+    subprocess.run([exe] + args, cwd=os.path.dirname(path), check=True,
+                   stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return time.perf_counter() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('-n', '--runs', type=int, default=200)
+    parser.add_argument('exes', nargs='+', metavar='LIMP_EXE')
+    args = parser.parse_args()
+
+    work_dir = tempfile.mkdtemp(prefix='limp_bench_')
+    try:
+        path = os.path.join(work_dir, 'bench.h')
+        with open(path, 'w', newline='\n') as f:
+            f.write(SOURCE)
+
+        exes = [os.path.abspath(exe) for exe in args.exes]
+        times = {(exe, mode): [] for exe in exes for mode in MODES}
+
+        # write the .limphash, then warm up the page cache and the filesystem
+        for exe in exes:
+            for mode, make_args in MODES.items():
+                for _ in range(5):
+                    run_once(exe, make_args(path), path)
+
+        for _ in range(args.runs):
+            for exe in exes:
+                for mode, make_args in MODES.items():
+                    times[(exe, mode)].append(run_once(exe, make_args(path), path))
+
+        for exe in exes:
+            for mode in MODES:
+                t = times[(exe, mode)]
+                print('{} ({}): mean {:.2f} ms, median {:.2f} ms, min {:.2f} ms ({} runs)'.format(
+                    exe, mode, statistics.mean(t) * 1000, statistics.median(t) * 1000, min(t) * 1000, len(t)))
+    finally:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -25,6 +25,7 @@ local setmetatable = setmetatable
 local fs = require('be.fs')
 local util = require('be.util')
 local blt = require('be.blt')
+local native = require('be.limp')
 
 do -- strict.lua
    -- checks uses of undeclared global variables
@@ -74,139 +75,28 @@ prefix = nil
 postfix = nil
 root_dir = nil
 
-function trim_trailing_ws (str)
-   return str:gsub('[ \t]+(\r?\n)', '%1'):gsub('[ \t]+$', '')
-end
-
-function postprocess (str)
-   return trim_trailing_ws(str)
-end
-
-do -- indent
-   local current_indent = 0
-
-   function get_indent ()
-      local retval = ''
-      if base_indent ~= nil and base_indent ~= '' then
-         retval = base_indent
-      end
-      return retval .. string.rep(indent_char, current_indent * indent_size)
-   end 
-
-   function write_indent ()
-      if base_indent ~= nil and base_indent ~= '' then
-         write(base_indent)
-      end
-      local indent = string.rep(indent_char, current_indent * indent_size)
-      if indent ~= '' then
-         write(indent)
-      end
-   end
-
-   function reset_indent ()
-      current_indent = 0
-   end
-
-   function indent (count)
-      if count == nil then count = 1 end
-      current_indent = current_indent + count
-   end
-
-   function unindent (count)
-      if count == nil then count = 1 end
-      current_indent = current_indent - count
-   end
-
-   function set_indent (count)
-      current_indent = count
-   end
-
-end
-
-function indent_newlines (str)
-   str = str:gsub('\n', '\n' .. get_indent())
-   return str
-end
-
-do -- write
-   local out = nil
-   local n = 1
-
-   local function init ()
-      reset_indent()
-      out = { }
-      n = 1
-
-      write_prefix()
-   end
-
-   function nl ()
-      if out == nil then
-         init()
-      end
-      out[n] = '\n'
-      n = n + 1
-      write_indent()
-   end
-
-   function write (...)
-      if out == nil then
-         init()
-      end
-      for i = 1, select('#', ...) do
-         local x = select(i, ...)
-         if x ~= nil then
-            out[n] = x
-            n = n + 1
-         end
-      end
-   end
-
-   function writeln (...)
-      if out == nil then
-         init()
-      end
-      for i = 1, select('#', ...) do
-         local x = select(i, ...)
-         if x ~= nil then
-            out[n] = x
-            n = n + 1
-         end
-      end
-      nl()
-   end
-
-   function write_lines (...)
-      if out == nil then
-         init()
-      end
-      for i = 1, select('#', ...) do
-         local x = select(i, ...)
-         if x ~= nil then
-            out[n] = x
-            n = n + 1
-         end
-         nl()
-      end
-   end
-
-   function reset ()
-      if out == nil then
-         init()
-      end
-      
-      write_postfix()
-
-      local str = table.concat(out)
-      out = nil
-
-      if type(postprocess) == 'function' then
-         str = postprocess(str)
-      end
-
-      return str
-   end
-end
+-- Output buffering and indentation are implemented natively.  When postprocess is left as trim_trailing_ws, trimming,
+-- newline normalization, and line counting are all done in a single pass over the output.
+trim_trailing_ws = native.trim_trailing_ws
+postprocess = trim_trailing_ws
+
+get_indent = native.get_indent
+write_indent = native.write_indent
+reset_indent = native.reset_indent
+indent = native.indent
+unindent = native.unindent
+set_indent = native.set_indent
+indent_newlines = native.indent_newlines
+
+nl = native.nl
+write = native.write
+writeln = native.writeln
+write_lines = native.write_lines
+write_indented = native.write_indented
+write_c_string_literal = native.write_c_string_literal
+reset = native.reset
+
+c_string_literal = native.c_string_literal
 
 function write_prefix ()
    if prefix ~= nil then
@@ -227,6 +117,9 @@ function write_postfix ()
    end
 end
 
+-- calls to include scripts and templates that are in progress; see memoization, below
+local memo_frames = { }
+
 do -- dependencies
    local deps = { }
 
@@ -239,44 +132,160 @@ do -- dependencies
          return
       end
 
-      local depfile = ''
-      local depfile_exists = false
-      if fs.exists(depfile_path) then
-         depfile = fs.get_file_contents(depfile_path)
-         depfile_exists = true
+      local prefix = get_depfile_target() .. ':'
+      local depfile_line = { prefix }
+      for k, v in pairs(deps) do
+         depfile_line[#depfile_line + 1] = ' '
+         depfile_line[#depfile_line + 1] = k
+      end
+      depfile_line = table.concat(depfile_line)
+
+      -- the depfile may be shared with other limp processes, so it's locked while being updated
+      native.update_depfile(depfile_path, prefix, depfile_line)
+   end
+
+   function dependency (path)
+      if path and path ~= '' then
+         deps[path] = true
+         for i = 1, #memo_frames do
+            memo_frames[i].deps[path] = true
+         end
+      end
+   end
+
+   function clear_dependencies ()
+      deps = { }
+   end
+
+   function get_dependencies ()
+      local list = { }
+      for k in pairs(deps) do
+         list[#list + 1] = k
+      end
+      table.sort(list)
+      return list
+   end
+end
+
+-- Include scripts and templates may call pure() to declare that their output and return values depend only on their
+-- arguments and the current indentation.  Later calls with the same script and arguments, from any file processed in the
+-- same run, then replay the recorded output and dependencies instead of running the script again.  Arguments and return
+-- values must be nil, booleans, numbers, strings, or tables of those (without metatables); otherwise the call is never
+-- memoized.  Any other side effects of a pure script are lost when its result is replayed.
+local memo_call
+do -- memoization
+   local serialize_value
+
+   local function serialize_table (t, out, depth)
+      if depth > 32 or getmetatable(t) ~= nil then
+         return false
       end
 
-      do
-         local prefix = get_depfile_target() .. ':'
-         local depfile_line = { prefix }
-         for k, v in pairs(deps) do
-            depfile_line[#depfile_line + 1] = ' '
-            depfile_line[#depfile_line + 1] = k
+      local entries = { }
+      for k, v in pairs(t) do
+         local entry = { '[' }
+         if not serialize_value(k, entry, depth + 1) then
+            return false
+         end
+         entry[#entry + 1] = ']='
+         if not serialize_value(v, entry, depth + 1) then
+            return false
          end
-         depfile_line = table.concat(depfile_line)
+         entries[#entries + 1] = table.concat(entry)
+      end
+      table.sort(entries)
 
-         local found_existing
-         depfile = depfile:gsub(blt.gsub_escape(prefix) .. '[^\r\n]+', function ()
-            found_existing = true
-            return depfile_line
-         end, 1)
+      out[#out + 1] = '{'
+      out[#out + 1] = table.concat(entries, ',')
+      out[#out + 1] = '}'
+      return true
+   end
 
-         if not found_existing then
-            depfile = depfile .. depfile_line .. '\n'
+   serialize_value = function (value, out, depth)
+      local t = type(value)
+      if t == 'string' then
+         out[#out + 1] = string.format('%q', value)
+      elseif t == 'number' then
+         if math.type(value) == 'integer' then
+            out[#out + 1] = string.format('%d', value)
+         elseif value ~= value then
+            out[#out + 1] = '(0/0)'
+         elseif value == math.huge then
+            out[#out + 1] = '(1/0)'
+         elseif value == -math.huge then
+            out[#out + 1] = '(-1/0)'
+         else
+            out[#out + 1] = string.format('%a', value)
          end
+      elseif t == 'boolean' or t == 'nil' then
+         out[#out + 1] = tostring(value)
+      elseif t == 'table' then
+         return serialize_table(value, out, depth)
+      else
+         return false
       end
+      return true
+   end
 
-      if not depfile_exists then
-         fs.create_dirs(fs.parent_path(depfile_path))
+   -- returns a Lua expression list which evaluates to the parameters, or nil if any can't be serialized
+   local function serialize (...)
+      local out = { }
+      for i = 1, select('#', ...) do
+         if i > 1 then
+            out[#out + 1] = ','
+         end
+         if not serialize_value((select(i, ...)), out, 0) then
+            return nil
+         end
       end
-      fs.put_file_contents(depfile_path, depfile)
+      return table.concat(out)
    end
 
-   function dependency (path)
-      if path and path ~= '' then
-         deps[path] = true
+   function pure ()
+      local frame = memo_frames[#memo_frames]
+      if frame then
+         frame.pure = true
       end
    end
+
+   memo_call = function (id, fn, ...)
+      -- starting the output resets the indent level, so it must happen before the level is captured in the key
+      local position = native.output_position()
+      local args = serialize(base_indent, indent_char, indent_size, native.get_indent_level(), ...)
+      if args == nil then
+         return fn(...)
+      end
+
+      local key = id .. '\0' .. args
+      local output, indent_delta, results, deps = native.memo_find(key)
+      if output ~= nil then
+         write(output)
+         indent(indent_delta)
+         for i = 1, #deps do
+            dependency(fs.ancestor_relative(deps[i], root_dir))
+         end
+         return load('return ' .. results, '=memoized results', 't', { })()
+      end
+
+      local frame = { deps = { } }
+      memo_frames[#memo_frames + 1] = frame
+      local level = native.get_indent_level()
+      local retvals = table.pack(fn(...))
+      memo_frames[#memo_frames] = nil
+
+      if frame.pure then
+         results = serialize(table.unpack(retvals, 1, retvals.n))
+         if results ~= nil then
+            local dep_list = { }
+            for k in pairs(frame.deps) do
+               dep_list[#dep_list + 1] = k
+            end
+            native.memo_store(key, native.output_since(position), native.get_indent_level() - level, results, dep_list, root_dir)
+         end
+      end
+
+      return table.unpack(retvals, 1, retvals.n)
+   end
 end
 
 require_load = util.require_load
@@ -288,7 +297,7 @@ function require_load_file (path, chunk_name)
       chunk_name = '@' .. fs.path_filename(path)
    end
    dependency(fs.ancestor_relative(path, root_dir))
-   local contents = fs.get_file_contents(path)
+   local contents = native.read_file(path)
    return util.require_load(contents, chunk_name)
 end
 
@@ -297,13 +306,77 @@ function get_file_contents (path)
       error('Path \'' .. path .. '\' does not exist!')
    end
    dependency(fs.ancestor_relative(path, root_dir))
-   return fs.get_file_contents(path)
+   return native.read_file(path)
+end
+
+-- Reads several files concurrently and returns a table of their contents, in the same order as the paths provided.
+function get_files_contents (paths)
+   for i = 1, #paths do
+      dependency(fs.ancestor_relative(paths[i], root_dir))
+   end
+   return native.read_files(paths)
+end
+
+-- Begins reading several files in the background and returns a function which retrieves a table of their contents.
+-- When called from a coroutine, that function yields until the reads are complete, instead of blocking.
+function prefetch_files (paths)
+   for i = 1, #paths do
+      dependency(fs.ancestor_relative(paths[i], root_dir))
+   end
+   local batch = native.prefetch_files(paths)
+   return function ()
+      while not batch:ready() do
+         if coroutine.isyieldable() then
+            coroutine.yield()
+         else
+            batch:wait()
+         end
+      end
+      return batch:contents()
+   end
 end
 
 get_template = blt.get_template
-register_template_dir = blt.register_template_dir
-register_template_file = blt.register_template_file
-register_template_string = blt.register_template_string
+
+do -- template registration
+   -- Memoized template results are only shared between files which use the same .limprc and have registered the same
+   -- templates
+   local registrations = { }
+   local registrations_hash
+   local hashed_limprc_path
+
+   local function registered (kind, ...)
+      local args = { kind }
+      for i = 1, select('#', ...) do
+         args[#args + 1] = tostring((select(i, ...)))
+      end
+      registrations[#registrations + 1] = table.concat(args, '\0')
+      registrations_hash = nil
+   end
+
+   function register_template_dir (...)
+      registered('dir', ...)
+      return blt.register_template_dir(...)
+   end
+
+   function register_template_file (...)
+      registered('file', ...)
+      return blt.register_template_file(...)
+   end
+
+   function register_template_string (...)
+      registered('string', ...)
+      return blt.register_template_string(...)
+   end
+
+   function get_template_registrations_hash ()
+      if registrations_hash == nil or hashed_limprc_path ~= limprc_path then
+         hashed_limprc_path = limprc_path
+         registrations_hash = native.content_hash((limprc_path or '') .. '\n' .. table.concat(registrations, '\n'))
+      end
+      return registrations_hash
+   end
+end
 
 pgsub = blt.pgsub
 explode = blt.explode
@@ -312,57 +385,86 @@ rpad = blt.rpad
 lpad = blt.lpad
 
 function template (template_name, ...)
-   return blt.get_template(template_name)(...)
+   native.count_metric('template_calls')
+   local id = 'template\0' .. template_name .. '\0' .. get_template_registrations_hash()
+   return memo_call(id, blt.get_template(template_name), ...)
 end
 
 function write_template (template_name, ...)
-   write(indent_newlines(template(template_name, ...)))
+   write_indented(template(template_name, ...))
 end
 
 function write_file (path)
    if fs.exists(path) then
       dependency(fs.ancestor_relative(path, root_dir))
-      write(indent_newlines(fs.get_file_contents(path)))
+      write_indented(native.read_file(path))
    end
 end
 
 -- Passes through the output from from a child process's stdout to the generated code.  stderr is not redirected.
 function write_proc (command)
    local f = io.popen(command, 'r')
-   write(indent_newlines(f:read('a')))
+   write_indented(f:read('a'))
    f:close()
 end
 
 do -- include
    local chunks = { }
+   local chunk_hashes = { }
+   local chunk_paths = { }
    local include_dirs = { }
+   local include_dirs_hash
+   local hashed_limprc_path
+
+   -- native.find_include answers from cached directory listings; fs.find_file is only needed for directories it can't list
+   local function find_include_file (path)
+      local found = native.find_include(path, include_dirs, true)
+      if found == nil then
+         found = fs.find_file(path, table.unpack(include_dirs))
+      end
+      return found or nil
+   end
+
+   local function resolve_include (path)
+      local found = native.find_include(path, include_dirs, false)
+      if found == nil then
+         found = fs.resolve_path(path, include_dirs)
+      end
+      return found or nil
+   end
+
+   local function load_include (include_name, path, chunk_name)
+      local contents = native.read_file(path)
+      local fn = util.require_load(contents, chunk_name)
+      chunks[include_name] = fn
+      chunk_hashes[include_name] = native.content_hash(contents)
+      chunk_paths[include_name] = path
+      return fn, chunk_hashes[include_name]
+   end
 
    function get_include (include_name)
       if not include_name then
          error 'Must specify include script name!'
       end
       
+      -- chunks outlive a single file when contexts are reused, and memo frames need to see every include used while
+      -- they're open, so the dependency must be recorded on every call, not just the first
       local existing = chunks[include_name]
       if existing ~= nil then
-         return existing
+         dependency(fs.ancestor_relative(chunk_paths[include_name], root_dir))
+         return existing, chunk_hashes[include_name]
       end
 
-      local path = fs.find_file(include_name, table.unpack(include_dirs))
+      local path = find_include_file(include_name)
       if path then
          dependency(fs.ancestor_relative(path, root_dir))
-         local contents = fs.get_file_contents(path)
-         local fn = util.require_load(contents, '@' .. include_name)
-         chunks[include_name] = fn
-         return fn
+         return load_include(include_name, path, '@' .. include_name)
       end
 
-      path = fs.find_file(include_name .. '.lua', table.unpack(include_dirs))
+      path = find_include_file(include_name .. '.lua')
       if path then
          dependency(fs.ancestor_relative(path, root_dir))
-         local contents = fs.get_file_contents(path)
-         local fn = util.require_load(contents, '@' .. include_name .. '.lua')
-         chunks[include_name] = fn
-         return fn
+         return load_include(include_name, path, '@' .. include_name .. '.lua')
       end
 
       error('No include found matching \'' .. include_name .. '\'')
@@ -376,33 +478,99 @@ do -- include
          end
       end
       include_dirs[n + 1] = fs.canonical(path)
+      include_dirs_hash = nil
+   end
+
+   -- Memoized includes may resolve nested includes and record dependencies, so identical scripts in different trees
+   -- must not share results.
+   function get_include_dirs_hash ()
+      if include_dirs_hash == nil or hashed_limprc_path ~= limprc_path then
+         hashed_limprc_path = limprc_path
+         include_dirs_hash = native.content_hash((limprc_path or '') .. '\n' .. table.concat(include_dirs, '\n'))
+      end
+      return include_dirs_hash
    end
 
    function resolve_include_path (path)
-      return fs.resolve_path(path, include_dirs) or fs.resolve_path(path .. '.lua', include_dirs)
+      return resolve_include(path) or resolve_include(path .. '.lua')
    end
 end
 
 
 function include (include_name, ...)
-   return get_include(include_name)(...)
+   native.count_metric('include_calls')
+   local fn, hash = get_include(include_name)
+   return memo_call('include\0' .. include_name .. '\0' .. hash .. '\0' .. get_include_dirs_hash(), fn, ...)
 end
 
+-- native.find_limprc remembers the .limprc found for each directory, so sibling files don't repeat the search up the tree
 function import_limprc (path)
-   local p = fs.compose_path(path, '.limprc')
-   if fs.exists(p) then
+   local p, dir = native.find_limprc(path)
+   root_dir = dir
+   if p then
       limprc_path = p
-      root_dir = path
       dofile(p)
       return true
    end
+   return false
+end
+
+do -- global snapshot
+   local snapshot, declared_snapshot
+
+   -- Records the current set of globals, so that they can be restored when this context is reused for another file.
+   -- This is a shallow copy; tables referenced by globals are not copied.  .limprc is not re-run for later files, so
+   -- anything it derived from file_path, file_dir, or the working directory still reflects the first file.
+   function snapshot_globals ()
+      local declared = getmetatable(_G).__declared
+      snapshot, declared_snapshot = { }, { }
+      for k, v in pairs(_G) do
+         snapshot[k] = v
+      end
+      for k, v in pairs(declared) do
+         declared_snapshot[k] = v
+      end
+   end
+
+   function restore_globals ()
+      if snapshot == nil then
+         return
+      end
 
-   if fs.root_path(path) == path then
-      root_dir = path
-      return false
+      local declared = getmetatable(_G).__declared
+      for k in pairs(declared) do
+         if declared_snapshot[k] == nil then
+            declared[k] = nil
+         end
+      end
+      for k, v in pairs(declared_snapshot) do
+         declared[k] = v
+      end
+
+      for k in pairs(_G) do
+         if snapshot[k] == nil then
+            rawset(_G, k, nil)
+         end
+      end
+      for k, v in pairs(snapshot) do
+         rawset(_G, k, v)
+      end
    end
+end
 
-   return import_limprc(fs.parent_path(path))
+-- Called instead of reloading the LIMP core when a context is reused for another file.  This restores the globals to
+-- how they were after the core and .limprc were first loaded, and discards any other state left behind by the previous
+-- file.  The file_* globals are updated afterwards.
+function begin_file ()
+   restore_globals()
+   clear_dependencies()
+   for i = #memo_frames, 1, -1 do
+      memo_frames[i] = nil
+   end
+   native.discard_output()
+   last_generated_data = nil
+   base_indent = nil
 end
 
 import_limprc(fs.parent_path(file_path))
+snapshot_globals()
@@ -0,0 +1,141 @@
+#include "atomic_file.hpp"
+#include <atomic>
+#include <fstream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace be::limp {
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+U64 process_id() {
+#ifdef _WIN32
+   return (U64)_getpid();
+#else
+   return (U64)getpid();
+#endif
+}
+
+} // be::limp::()
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Generates a name for a temporary file in the same directory as
+/// path (so that it can be renamed over it) which won't collide with any
+/// other limp process or thread.
+Path unique_temp_path(const Path& path) {
+   static std::atomic<U64> counter(0);
+   return Path(path.string() + ".limptmp." + std::to_string(process_id()) + "." + std::to_string(counter++));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Replaces a file with a temporary file, preserving the original
+/// file's permissions if it exists.
+///
+/// \details The temporary file is removed if it can't be renamed.
+void replace_file(const Path& temp_path, const Path& path) {
+   std::error_code ec;
+   fs::file_status status = fs::status(path, ec);
+   if (!ec && fs::exists(status)) {
+      fs::permissions(temp_path, status.permissions(), ec);
+   }
+
+   fs::rename(temp_path, path, ec);
+   if (ec) {
+      std::error_code remove_ec;
+      fs::remove(temp_path, remove_ec);
+      throw fs::filesystem_error("Could not replace file", temp_path, path, ec);
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Writes a file by writing a temporary file next to it and then
+/// renaming it into place.
+///
+/// \details Other processes reading the file will see either the old
+/// contents or the new contents, never a partially written file.
+void put_file_contents_atomic(const Path& path, SV contents, bool text) {
+   Path temp_path = unique_temp_path(path);
+
+   std::ofstream ofs;
+   ofs.exceptions(std::ios_base::goodbit);
+   ofs.open(temp_path.native(), text ? std::ios_base::out | std::ios_base::trunc
+                                     : std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+   if (!ofs) {
+      throw fs::filesystem_error("Could not open file for writing", temp_path, std::make_error_code(std::errc::io_error));
+   }
+
+   ofs.write(contents.data(), (std::streamsize)contents.size());
+   ofs.close();
+   if (!ofs) {
+      std::error_code ec;
+      fs::remove(temp_path, ec);
+      throw fs::filesystem_error("Error while writing file", temp_path, std::make_error_code(std::errc::io_error));
+   }
+
+   replace_file(temp_path, path);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FileLock::FileLock(const Path& path) {
+   Path lock_path(path.string() + ".lock");
+
+#ifdef _WIN32
+   HANDLE handle = CreateFileW(lock_path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+   if (handle == INVALID_HANDLE_VALUE) {
+      throw fs::filesystem_error("Could not open lock file", lock_path, std::error_code((int)GetLastError(), std::system_category()));
+   }
+
+   OVERLAPPED overlapped = { };
+   if (!LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+      std::error_code ec((int)GetLastError(), std::system_category());
+      CloseHandle(handle);
+      throw fs::filesystem_error("Could not lock file", lock_path, ec);
+   }
+
+   handle_ = handle;
+#else
+   int fd = open(lock_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+   if (fd < 0) {
+      throw fs::filesystem_error("Could not open lock file", lock_path, std::error_code(errno, std::generic_category()));
+   }
+
+   int result;
+   do {
+      result = flock(fd, LOCK_EX);
+   } while (result != 0 && errno == EINTR);
+
+   if (result != 0) {
+      std::error_code ec(errno, std::generic_category());
+      close(fd);
+      throw fs::filesystem_error("Could not lock file", lock_path, ec);
+   }
+
+   fd_ = fd;
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FileLock::~FileLock() {
+#ifdef _WIN32
+   OVERLAPPED overlapped = { };
+   UnlockFileEx(handle_, 0, MAXDWORD, MAXDWORD, &overlapped);
+   CloseHandle(handle_);
+#else
+   flock(fd_, LOCK_UN);
+   close(fd_);
+#endif
+}
+
+} // be::limp
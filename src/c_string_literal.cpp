@@ -0,0 +1,240 @@
+#include "c_string_literal.hpp"
+#include <array>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BE_LIMP_C_STRING_LITERAL_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace be::limp {
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+struct Escape {
+   char str[5];
+   U8 length; // 1 for bytes that don't need escaping
+   bool octal;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Builds the escape sequence used for each byte value.
+///
+/// \details Bytes which could be mistaken for (or interfere with) trigraphs,
+/// preprocessor tokens, or printf-style format specifiers are escaped along
+/// with all non-printable bytes.  Octal escapes use as few digits as possible.
+std::array<Escape, 256> make_escape_table() {
+   std::array<Escape, 256> table { };
+   for (int b = 0; b < 256; ++b) {
+      Escape& e = table[b];
+      char named = 0;
+      switch (b) {
+         case '\a': named = 'a'; break;
+         case '\b': named = 'b'; break;
+         case '\t': named = 't'; break;
+         case '\n': named = 'n'; break;
+         case '\v': named = 'v'; break;
+         case '\f': named = 'f'; break;
+         case '\r': named = 'r'; break;
+         case '\\': named = '\\'; break;
+         case '?':  named = '?'; break;
+      }
+
+      if (named) {
+         e.str[0] = '\\';
+         e.str[1] = named;
+         e.length = 2;
+      } else if (b < 32 || b >= 127 || b == '"' || b == '#' || b == '%' || b == '+' || b == ':') {
+         U8 n = 0;
+         e.str[n++] = '\\';
+         if (b >= 64) {
+            e.str[n++] = (char)('0' + (b >> 6));
+         }
+         if (b >= 8) {
+            e.str[n++] = (char)('0' + ((b >> 3) & 7));
+         }
+         e.str[n++] = (char)('0' + (b & 7));
+         e.length = n;
+         e.octal = true;
+      } else {
+         e.str[0] = (char)b;
+         e.length = 1;
+      }
+   }
+   return table;
+}
+
+const std::array<Escape, 256>& escape_table() {
+   static const std::array<Escape, 256> table = make_escape_table();
+   return table;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool is_digit(UC c) {
+   return c >= '0' && c <= '9';
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Returns the number of bytes at the start of data which can be
+/// copied to the output without escaping.
+std::size_t plain_run_length(const UC* data, std::size_t size) {
+   const auto& table = escape_table();
+   std::size_t i = 0;
+
+#ifdef BE_LIMP_C_STRING_LITERAL_SSE2
+   const __m128i lower = _mm_set1_epi8(31);
+   const __m128i upper = _mm_set1_epi8(127);
+   const __m128i quote = _mm_set1_epi8('"');
+   const __m128i hash = _mm_set1_epi8('#');
+   const __m128i percent = _mm_set1_epi8('%');
+   const __m128i plus = _mm_set1_epi8('+');
+   const __m128i colon = _mm_set1_epi8(':');
+   const __m128i question = _mm_set1_epi8('?');
+   const __m128i backslash = _mm_set1_epi8('\\');
+
+   for (; i + 16 <= size; i += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+      // signed compares: bytes >= 128 are negative, so fail the lower bound
+      __m128i plain = _mm_and_si128(_mm_cmpgt_epi8(v, lower), _mm_cmplt_epi8(v, upper));
+      __m128i special = _mm_or_si128(
+         _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, hash)),
+                      _mm_or_si128(_mm_cmpeq_epi8(v, percent), _mm_cmpeq_epi8(v, plus))),
+         _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, colon), _mm_cmpeq_epi8(v, question)),
+                      _mm_cmpeq_epi8(v, backslash)));
+      U32 mask = (U32)_mm_movemask_epi8(_mm_andnot_si128(special, plain));
+      if (mask != 0xFFFF) {
+         U32 escaped = ~mask & 0xFFFF;
+         while (!(escaped & 1)) {
+            escaped >>= 1;
+            ++i;
+         }
+         return i;
+      }
+   }
+#endif
+
+   while (i < size && table[data[i]].length == 1) {
+      ++i;
+   }
+   return i;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+class LiteralWriter final {
+public:
+   LiteralWriter(S& out, std::size_t line_length, SV line_separator)
+      : out_(out),
+        line_length_(line_length),
+        separator_(line_separator) {
+      out_.push_back('"');
+   }
+
+   /// \brief  Appends a token which must not be split across lines.
+   void token(const char* str, std::size_t length) {
+      if (line_length_ > 0 && current_ > 0 && current_ + length > line_length_) {
+         break_line_();
+      }
+      out_.append(str, length);
+      current_ += length;
+   }
+
+   /// \brief  Appends a run of characters which don't need escaping, each of
+   /// which is a token on its own.
+   void plain(const UC* data, std::size_t size) {
+      while (size > 0) {
+         std::size_t n = size;
+         if (line_length_ > 0) {
+            if (current_ >= line_length_) {
+               break_line_();
+            }
+            n = std::min(n, line_length_ - current_);
+         }
+         out_.append(reinterpret_cast<const char*>(data), n);
+         current_ += n;
+         data += n;
+         size -= n;
+      }
+   }
+
+   void finish() {
+      out_.push_back('"');
+   }
+
+private:
+   void break_line_() {
+      out_.push_back('"');
+      out_.append(separator_);
+      out_.push_back('"');
+      current_ = 0;
+   }
+
+   S& out_;
+   std::size_t line_length_;
+   SV separator_;
+   std::size_t current_ = 0;
+};
+
+} // be::limp::()
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Appends one or more C string literals which together represent
+/// arbitrary binary data.
+///
+/// \details The output is wrapped into multiple literals, joined by
+/// line_separator, such that the contents of each literal don't exceed
+/// line_length characters (if nonzero) unless a single escape sequence would
+/// not fit.  A digit following an octal escape is either escaped itself, or
+/// if there are several digits in a row, they are placed in a new literal
+/// (i.e. "\0""123") so that they aren't parsed as part of the escape.
+///
+/// This must produce exactly the same output as the original Lua
+/// implementation, so that regenerating existing files doesn't change them.
+void append_c_string_literal(S& out, SV data, std::size_t line_length, SV line_separator) {
+   const auto& table = escape_table();
+   const UC* ptr = reinterpret_cast<const UC*>(data.data());
+   const std::size_t size = data.size();
+
+   out.reserve(out.size() + size * 2);
+   LiteralWriter writer(out, line_length, line_separator);
+
+   bool after_octal = false;
+   std::size_t i = 0;
+   while (i < size) {
+      if (after_octal && is_digit(ptr[i])) {
+         std::size_t end = i + 1;
+         while (end < size && is_digit(ptr[end])) {
+            ++end;
+         }
+
+         if (end - i == 1) {
+            const char escaped[] = { '\\', (char)('0' + (ptr[i] >> 3)), (char)('0' + (ptr[i] & 7)) };
+            writer.token(escaped, sizeof(escaped));
+            ++i;
+            continue; // still after_octal
+         }
+
+         S digits = "\"\"";
+         digits.append(reinterpret_cast<const char*>(ptr + i), end - i);
+         writer.token(digits.c_str(), digits.size());
+         after_octal = false;
+         i = end;
+         continue;
+      }
+
+      std::size_t run = plain_run_length(ptr + i, size - i);
+      if (run > 0) {
+         writer.plain(ptr + i, run);
+         after_octal = false;
+         i += run;
+         continue;
+      }
+
+      const Escape& e = table[ptr[i]];
+      writer.token(e.str, e.length);
+      after_octal = e.octal;
+      ++i;
+   }
+
+   writer.finish();
+}
+
+} // be::limp
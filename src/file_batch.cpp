@@ -0,0 +1,96 @@
+#include "file_batch.hpp"
+#include <be/util/get_file_contents.hpp>
+
+namespace be::limp {
+namespace {
+
+// Reads are mostly waiting on the filesystem (often a network share), so
+// it's worth having more of them in flight than there are cores.
+constexpr std::size_t max_concurrent_reads = 16;
+
+} // be::limp::()
+
+///////////////////////////////////////////////////////////////////////////////
+FileBatch::FileBatch(std::vector<Path> paths)
+   : paths_(std::move(paths)),
+     contents_(paths_.size()),
+     errors_(paths_.size()),
+     next_(0),
+     remaining_(paths_.size()) {
+   std::size_t n_threads = std::min(paths_.size(), max_concurrent_reads);
+   threads_.reserve(n_threads);
+   for (std::size_t i = 0; i < n_threads; ++i) {
+      threads_.emplace_back(&FileBatch::run_, this);
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FileBatch::~FileBatch() {
+   for (auto& thread : threads_) {
+      thread.join();
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t FileBatch::size() const {
+   return paths_.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool FileBatch::ready() const {
+   return remaining_.load() == 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FileBatch::wait() {
+   std::unique_lock<std::mutex> lock(mutex_);
+   done_.wait(lock, [this]() { return ready(); });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const Path& FileBatch::path(std::size_t index) const {
+   return paths_[index];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const S& FileBatch::contents(std::size_t index) const {
+   return contents_[index];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Retrieves a description of the problem encountered while reading
+/// the file at the specified index, or an empty string if it was read
+/// successfully.
+const S& FileBatch::error(std::size_t index) const {
+   return errors_[index];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void FileBatch::run_() {
+   for (;;) {
+      std::size_t index = next_++;
+      if (index >= paths_.size()) {
+         break;
+      }
+
+      const Path& path = paths_[index];
+      try {
+         if (!fs::exists(path)) {
+            errors_[index] = "Path '" + path.string() + "' does not exist!";
+         } else {
+            contents_[index] = util::get_file_contents_string(path);
+         }
+      } catch (const fs::filesystem_error& e) {
+         errors_[index] = e.what();
+      } catch (const std::exception& e) {
+         errors_[index] = e.what();
+      }
+
+      if (--remaining_ == 0) {
+         std::lock_guard<std::mutex> lock(mutex_);
+         done_.notify_all();
+      }
+   }
+}
+
+} // be::limp
@@ -0,0 +1,105 @@
+#include "include_index.hpp"
+#include <cctype>
+
+namespace be::limp {
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+S entry_key(S name) {
+#ifdef _WIN32
+   // Windows paths are case-insensitive
+   for (char& c : name) {
+      c = (char)std::tolower((unsigned char)c);
+   }
+#endif
+   return name;
+}
+
+} // be::limp::()
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Searches a list of directories for the first one that contains
+/// the specified relative path.
+///
+/// \details Returns IncludeLookup::unindexed if the name is absolute or
+/// contains '.' or '..' components; the caller should fall back to searching
+/// the filesystem directly in that case.
+IncludeLookup IncludeIndex::find(const S& name, const std::vector<Path>& dirs, bool files_only, Path& result) {
+   Path relative(name);
+   if (name.empty() || relative.has_root_path()) {
+      return IncludeLookup::unindexed;
+   }
+
+   for (const Path& component : relative) {
+      S str = component.string();
+      if (str.empty() || str == "." || str == "..") {
+         return IncludeLookup::unindexed;
+      }
+   }
+
+   const Path parent = relative.parent_path();
+   const S key = entry_key(relative.filename().string());
+
+   std::lock_guard<std::mutex> lock(mutex_);
+   for (const Path& dir : dirs) {
+      Path search_dir = parent.empty() ? dir : dir / parent;
+      const Listing& listing = listing_(search_dir);
+      auto it = listing.entries.find(key);
+      if (it != listing.entries.end() && (it->second.is_file || !files_only)) {
+         result = search_dir / it->second.name;
+         return IncludeLookup::found;
+      }
+   }
+
+   return IncludeLookup::not_found;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void IncludeIndex::next_generation() {
+   std::lock_guard<std::mutex> lock(mutex_);
+   ++generation_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const IncludeIndex::Listing& IncludeIndex::listing_(const Path& dir) {
+   Listing& listing = listings_[dir.generic_string()];
+   if (listing.generation == generation_) {
+      return listing;
+   }
+
+   listing.generation = generation_;
+
+   std::error_code ec;
+   mtime_type mtime = fs::last_write_time(dir, ec);
+   if (ec) {
+      listing.exists = false;
+      listing.entries.clear();
+      return listing;
+   }
+
+   if (listing.exists && mtime == listing.mtime) {
+      return listing;
+   }
+
+   listing.exists = true;
+   listing.mtime = mtime;
+   listing.entries.clear();
+
+   for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+      std::error_code status_ec;
+      S name = it->path().filename().string();
+      bool is_file = fs::is_regular_file(it->status(status_ec));
+      S key = entry_key(name);
+      listing.entries[key] = Entry { std::move(name), is_file };
+   }
+
+   return listing;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+IncludeIndex& include_index() {
+   static IncludeIndex index;
+   return index;
+}
+
+} // be::limp
@@ -1,5 +1,7 @@
 #include "limp_app.hpp"
 #include "limp_processor.hpp"
+#include "limprc_cache.hpp"
+#include "metrics.hpp"
 #include "version.hpp"
 #include <be/core/logging.hpp>
 #include <be/core/version.hpp>
@@ -10,19 +12,104 @@
 #include <be/cli/cli.hpp>
 #include <be/belua/log_exception.hpp>
 #include <be/core/log_exception.hpp>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
 namespace be {
 namespace limp {
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Adds the sections of the help and version text which aren't
+/// needed to parse the command line.
+///
+/// \details Only called when help or version information will actually be
+/// shown, so that normal invocations don't pay to build them.
+void add_description(cli::Processor& proc, bool show_version) {
+   using namespace cli;
+   using namespace color;
+   using namespace ct;
+
+   proc
+      (prologue (Table() << header << "LIMP").query())
+
+      (synopsis (Cell() << fg_dark_gray << "[ " << fg_cyan << "OPTIONS"
+                        << fg_dark_gray << " ] [ " << fg_cyan << "INPUT"
+                        << fg_dark_gray << " [ " << fg_cyan << "INPUT"
+                        << fg_dark_gray << " ...]]"))
+
+      (abstract ("The Lua Inline Metaprogramming Processor (LIMP) looks for specially constructed comments in source code, "
+                 "executes them as Lua scripts, and inserts or replaces the results in the original source file."))
+
+      (summary ("For each input file, LIMP will look for comments that contain '!!' immediately following the "
+                "comment opener.  It will then treat the comment as Lua code until it encounters another '!!' sequence or "
+                "the end of the comment.  If it finds a second '!!', it will try to interpret the remaining characters as "
+                "an integer, indicating the number of lines following the comment which were previously generated by LIMP.  "
+                "These lines will be replaced by any lines generated by the Lua code.").verbose())
+
+      (summary ("The sequences of characters that are treated as comment openers and closers can be customized by creating a "
+                ".limpconf file in the directory that contains the limp executable.  Blank lines and lines that begin with "
+                "'#' are ignored.  Otherwise, each line must have exactly 3 tokens separated by whitespace.  The first is the "
+                "file extension for which the line applies (without the leading '.').  The second token is a sequence of "
+                "characters that denotes the start of a comment, and the last is one that end a comment.  If the same "
+                "extension is specified multiple times, only the last one is valid.  If a line is specified for the extension "
+                "'!!', it overrides the default '!!' tokens that indicate the start and end of Lua code.").verbose())
+
+      (summary ("Note: LIMP does not do any Lua syntax parsing when looking for the LIMP and/or comment end tokens.  In "
+                "particular '!!' will be found even if it is inside a Lua string literal.").verbose())
+
+      (summary ("When there are multiple input files being processed, a new Lua environment is constructed for each input "
+                "file that is processed.  The order that files are processed is undefined.").verbose())
+
+      (summary ("If there are multiple LIMP comments in the same file, they will be processed sequentially, using the same "
+                "environment for all comments (but each comment is loaded as a separate chunk, so they do not share locals).").verbose())
+
+      (summary ("A LIMP comment whose Lua code begins with the '--isolated' pragma declares that it does not depend on state left "
+                "behind by earlier comments.  Isolated comments are each executed in a new environment, concurrently with the rest "
+                "of the file, and their results are inserted in the same order as they appear in the source.  The "
+                "file_contents global is not available to isolated comments.").verbose())
+
+      (summary ("For each Lua environment that is created, the working directory will be set to the parent directory of the "
+                "file being processed.  If that directory contains a .limprc file, it will be loaded and executed.  Otherwise "
+                "the parent directory chain will be recursively searched until a .limprc file is found and executed or the "
+                "filesystem root is reached.").verbose())
+
+      (exit_code (0, "There were no errors."))
+      (exit_code (1, "An unknown error occurred."))
+      (exit_code (2, "There was a problem parsing the command line arguments."))
+      (exit_code (3, "There was a problem processing an input file."))
+      ;
+
+   if (show_version) {
+      proc
+         (prologue(BE_LIMP_VERSION_STRING).query())
+         (prologue(BE_BLT_VERSION_STRING).query())
+         (prologue(BE_UTIL_VERSION_STRING).query())
+         (prologue(BE_CORE_VERSION_STRING).query())
+         (prologue(LUA_RELEASE).query())
+         (license (BE_LICENSE).query())
+         (license (BE_COPYRIGHT).query())
+         (license (LUA_COPYRIGHT).query())
+         ;
+   }
+}
+
+} // be::limp::()
 
 ///////////////////////////////////////////////////////////////////////////////
 LimpApp::LimpApp(int argc, char** argv) {
    default_log().verbosity_mask(v::info_or_worse);
    init_default_langs_();
+
    try {
+      if (parse_inputs_only_(argc, argv)) {
+         return;
+      }
+
       using namespace cli;
       using namespace color;
       using namespace ct;
@@ -34,51 +121,27 @@ LimpApp::LimpApp(int argc, char** argv) {
       S help_query;
 
       proc
-         (prologue (Table() << header << "LIMP").query())
-
-         (synopsis (Cell() << fg_dark_gray << "[ " << fg_cyan << "OPTIONS"
-                           << fg_dark_gray << " ] [ " << fg_cyan << "INPUT"
-                           << fg_dark_gray << " [ " << fg_cyan << "INPUT"
-                           << fg_dark_gray << " ...]]"))
-
-         (abstract ("The Lua Inline Metaprogramming Processor (LIMP) looks for specially constructed comments in source code, "
-                    "executes them as Lua scripts, and inserts or replaces the results in the original source file."))
-
-         (summary ("For each input file, LIMP will look for comments that contain '!!' immediately following the "
-                   "comment opener.  It will then treat the comment as Lua code until it encounters another '!!' sequence or "
-                   "the end of the comment.  If it finds a second '!!', it will try to interpret the remaining characters as "
-                   "an integer, indicating the number of lines following the comment which were previously generated by LIMP.  "
-                   "These lines will be replaced by any lines generated by the Lua code.").verbose())
-
-         (summary ("The sequences of characters that are treated as comment openers and closers can be customized by creating a "
-                   ".limpconf file in the directory that contains the limp executable.  Blank lines and lines that begin with "
-                   "'#' are ignored.  Otherwise, each line must have exactly 3 tokens separated by whitespace.  The first is the "
-                   "file extension for which the line applies (without the leading '.').  The second token is a sequence of "
-                   "characters that denotes the start of a comment, and the last is one that end a comment.  If the same "
-                   "extension is specified multiple times, only the last one is valid.  If a line is specified for the extension "
-                   "'!!', it overrides the default '!!' tokens that indicate the start and end of Lua code.").verbose())
-
-         (summary ("Note: LIMP does not do any Lua syntax parsing when looking for the LIMP and/or comment end tokens.  In "
-                   "particular '!!' will be found even if it is inside a Lua string literal.").verbose())
-
-         (summary ("When there are multiple input files being processed, a new Lua environment is constructed for each input "
-                   "file that is processed.  The order that files are processed is undefined.").verbose())
-
-         (summary ("If there are multiple LIMP comments in the same file, they will be processed sequentially, using the same "
-                   "environment for all comments (but each comment is loaded as a separate chunk, so they do not share locals).").verbose())
-
-         (summary ("For each Lua environment that is created, the working directory will be set to the parent directory of the "
-                   "file being processed.  If that directory contains a .limprc file, it will be loaded and executed.  Otherwise "
-                   "the parent directory chain will be recursively searched until a .limprc file is found and executed or the "
-                   "filesystem root is reached.").verbose())
-
          // TODO --watch
-
          (flag({ "f" },{ "force" }, force_process_).desc("Always process files, even if they haven't changed since last being processed."))
          (flag({ "h" },{ "hash" }, write_hashes_).desc("Output the hash of any processed files to a .limphash file so that they can be skipped when unchanged."))
          (flag({ "n" },{ "dry-run" }, dry_run_).desc("Makes no changes, but reports which files would be changed if run without this option."))
          (flag({ "b" },{ "break-on-fail" }, stop_on_failure_).desc("Stops processing additional inputs after the first failure."))
          (flag({ "R" },{ "recursive" }, recursive_).desc("Recursively looks in subdirectories for files matching the input filenames."))
+         (flag({ },{ "stream" }, streaming_).desc("Reads input files in chunks and writes output incrementally, so that memory use is bounded by the largest LIMP comment rather than the file size.")
+            .extra(Cell() << nl << "Output is written to a temporary " << fg_cyan << ".limptmp" << reset << " file next to the input, which replaces it if anything changed.  "
+                             "The " << fg_cyan << "file_contents" << reset << " global is not available to LIMP scripts in this mode."))
+
+         (flag({ },{ "reuse-contexts" }, reuse_contexts_).desc("Reuses one Lua environment for all files that share a .limprc file, instead of creating a new one for each file.")
+            .extra(Cell() << nl << "The LIMP core and " << fg_cyan << ".limprc" << reset << " are only loaded once for each tree.  Before each file is processed, "
+                             "global variables are restored to how they were after " << fg_cyan << ".limprc" << reset << " was loaded.  This is a shallow "
+                             "restore; changes made by LIMP comments to tables or upvalues created by " << fg_cyan << ".limprc" << reset
+                          << " will be visible to later files." << nl << nl
+                          << "Because " << fg_cyan << ".limprc" << reset << " only runs once, it sees the " << fg_cyan << "file_path" << reset
+                          << ", " << fg_cyan << "file_dir" << reset << ", and working directory of whichever file happens to be processed first.  "
+                             "Relative paths passed to " << fg_cyan << "register_include_dir" << reset << " are resolved against that directory, "
+                             "and any other logic in " << fg_cyan << ".limprc" << reset << " that depends on the current file is not re-run.  "
+                             "Only use this option if " << fg_cyan << ".limprc" << reset << " resolves paths relative to " << fg_cyan << "root_dir" << reset
+                          << " or is otherwise independent of the file being processed."))
 
          (param ({ "D" },{ "input-dir" }, "PATH", [&](const S& str) {
                util::parse_multi_path(str, search_paths_);
@@ -89,14 +152,45 @@ LimpApp::LimpApp(int argc, char** argv) {
                                "are specified, the working directory is implicitly searched."))
 
          (param ({ },{ "depfile" }, "PATH", [&](const S& str) {
-               depfile_path_ = fs::absolute(util::parse_path(str));
-               if (fs::exists(depfile_path_)) {
-                  depfile_path_ = fs::canonical(depfile_path_);
-               }
+               set_depfile_path_(str);
             }).desc("Outputs included scripts and templates to a dependency file.")
               .extra(Cell() << nl << "The output is in a makefile format similar to that generated by " << fg_blue << "gcc " << fg_yellow << "-MMD"
                             << reset << ".  If a relative path is specified, it will be considered relative to the current working directory."))
 
+         (param ({ },{ "affected-by" }, "PATH", [&](const S& str) {
+               util::parse_multi_path(str, affected_by_);
+            }).desc("Processes only input files which depend, directly or transitively, on the specified files.")
+              .extra(Cell() << nl << "Dependencies are read from the " << fg_cyan << ".limpdeps" << reset << " records written alongside each file when "
+                            << fg_yellow << "--hash" << reset << " is used.  Input files without a record are assumed to be affected.  Affected files are always processed, as if "
+                            << fg_yellow << "--force" << reset << " were specified.  Multiple paths may be separated with ';' or ':', "
+                               "or by using multiple " << fg_yellow << "--affected-by" << reset << " options."))
+
+         (param ({ },{ "metrics-out" }, "PATH", [&](const S& str) {
+               metrics_path_ = fs::absolute(util::parse_path(str));
+            }).desc("Writes counters describing the work done during the run to a file when the run ends.")
+              .extra(Cell() << nl << "If the file's extension is " << fg_cyan << ".prom" << reset << ", the Prometheus text format is used.  "
+                               "Otherwise the counters are written as a JSON object.  Counters include the number of files scanned, skipped, "
+                               "and written, LIMP comments executed, bytes read and written, include and template cache hits, and time spent in Lua and file I/O.  Times are summed across threads, and file I/O performed by LIMP scripts is counted in both."))
+
+         (flag({ },{ "list-affected" }, list_affected_).desc(Cell() << "Outputs the input files that would be processed due to " << fg_yellow << "--affected-by" << reset << ", but does not process them."))
+
+         (param ({ },{ "shard" }, "K/N", [&](const S& str) {
+               parse_shard_(str);
+            }).desc("Processes only the K-th of N partitions of the input files, balanced using recorded processing times.")
+              .extra(Cell() << nl << "Processing times are recorded in " << fg_cyan << ".limphash" << reset << " files when "
+                            << fg_yellow << "--hash" << reset << " is used.  Files without a recorded time are assumed to take the "
+                               "average time.  Every shard must be run with the same inputs and " << fg_cyan << ".limphash" << reset
+                            << " files, or some files may be processed by several shards and others by none.  For this reason, recorded "
+                               "times are not updated while " << fg_yellow << "--shard" << reset << " is used, unless "
+                            << fg_yellow << "--record-costs" << reset << " is also specified."))
+
+         (flag({ },{ "record-costs" }, record_costs_).desc(Cell() << "Records processing times in " << fg_cyan << ".limphash" << reset
+                                                               << " files even when " << fg_yellow << "--shard" << reset << " is used.")
+            .extra(Cell() << nl << "Has no effect unless " << fg_yellow << "--hash" << reset << " is used.  This is only safe when shards "
+                               "don't overlap in time, since a shard that starts after another has updated some times may compute a "
+                               "different partition.  In CI setups that always use " << fg_yellow << "--shard" << reset << ", refresh "
+                               "times periodically by running the shards one after another (or a single unsharded run) with this option."))
+
          (flag({ },{ "test" }, test_).desc("Ignores other options, outputs nothing, and returns status code 0."))
 
          (any ([&](const S& str) {
@@ -121,11 +215,6 @@ LimpApp::LimpApp(int argc, char** argv) {
                             << " is provided, the options list will be filtered to show only options that contain that string."))
 
          (flag ({ },{ "help" }, verbose).ignore_values(true))
-
-         (exit_code (0, "There were no errors."))
-         (exit_code (1, "An unknown error occurred."))
-         (exit_code (2, "There was a problem parsing the command line arguments."))
-         (exit_code (3, "There was a problem processing an input file."))
          ;
 
       proc.process(argc, argv);
@@ -140,17 +229,8 @@ LimpApp::LimpApp(int argc, char** argv) {
          status_ = 1;
       }
 
-      if (show_version) {
-         proc
-            (prologue(BE_LIMP_VERSION_STRING).query())
-            (prologue(BE_BLT_VERSION_STRING).query())
-            (prologue(BE_UTIL_VERSION_STRING).query())
-            (prologue(BE_CORE_VERSION_STRING).query())
-            (prologue(LUA_RELEASE).query())
-            (license (BE_LICENSE).query())
-            (license (BE_COPYRIGHT).query())
-            (license (LUA_COPYRIGHT).query())
-            ;
+      if (show_help || show_version) {
+         add_description(proc, show_version);
       }
 
       if (show_help) {
@@ -194,9 +274,27 @@ int LimpApp::operator()() {
       return status_;
    }
 
-   try {
-      load_langs_();
+   run_();
+
+   if (!metrics_path_.empty()) {
+      try {
+         write_metrics(metrics_path_);
+      } catch (const fs::filesystem_error& e) {
+         status_ = std::max(status_, (I8)1);
+         log_exception(e);
+      } catch (const std::exception& e) {
+         status_ = std::max(status_, (I8)1);
+         log_exception(e);
+      }
+   }
 
+   return status_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LimpApp::run_() {
+   MetricsTimer timer(metrics().run_ns);
+   try {
       if (search_paths_.empty()) {
          search_paths_.push_back(util::cwd());
       }
@@ -209,7 +307,21 @@ int LimpApp::operator()() {
          get_paths_(job);
       }
 
-      for (auto& p : paths_) {
+      if (!paths_.empty()) {
+         load_langs_();
+      }
+
+      if (!affected_by_.empty() || list_affected_) {
+         select_affected_();
+         if (list_affected_) {
+            for (auto& p : paths_) {
+               std::cout << p.generic_string() << std::endl;
+            }
+            return;
+         }
+      }
+
+      for (auto& p : schedule_()) {
          process_(fs::absolute(p));
          if (stop_on_failure_ && status_ != 0) {
             break;
@@ -232,8 +344,69 @@ int LimpApp::operator()() {
       status_ = std::max(status_, (I8)1);
       log_exception(e);
    }
+}
 
-   return status_;
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Handles the command lines that build systems typically use,
+/// without building the full cli::Processor.
+///
+/// \details Besides input paths, only --hash, --stream, --depfile PATH, and
+/// --verbosity LEVEL are recognized.  Verbosity levels are still parsed by
+/// a cli::Processor, but one that knows only that option.
+///
+/// \returns false if any other option is present (or there are no input
+/// paths), in which case the full command line parser must be used.
+bool LimpApp::parse_inputs_only_(int argc, char** argv) {
+   std::vector<S> jobs;
+   std::vector<char*> verbosity_args { argv[0] };
+   bool write_hashes = false;
+   bool streaming = false;
+   const char* depfile = nullptr;
+
+   for (int i = 1; i < argc; ++i) {
+      SV arg = argv[i];
+      if (arg.empty() || arg[0] != '-') {
+         jobs.push_back(S(arg));
+      } else if (arg == "-h" || arg == "--hash") {
+         write_hashes = true;
+      } else if (arg == "--stream") {
+         streaming = true;
+      } else if (arg == "--depfile" && i + 1 < argc) {
+         depfile = argv[++i];
+      } else if ((arg == "-v" || arg == "--verbosity") && i + 1 < argc) {
+         verbosity_args.push_back(argv[i]);
+         verbosity_args.push_back(argv[++i]);
+      } else {
+         return false;
+      }
+   }
+
+   if (jobs.empty()) {
+      return false;
+   }
+
+   if (verbosity_args.size() > 1) {
+      cli::Processor proc;
+      proc(cli::verbosity_param({ "v" },{ "verbosity" }, "LEVEL", default_log().verbosity_mask()));
+      proc.process((int)verbosity_args.size(), verbosity_args.data());
+   }
+
+   if (depfile) {
+      set_depfile_path_(depfile);
+   }
+
+   write_hashes_ = write_hashes;
+   streaming_ = streaming;
+   jobs_ = std::move(jobs);
+   return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LimpApp::set_depfile_path_(const S& str) {
+   depfile_path_ = fs::absolute(util::parse_path(str));
+   if (fs::exists(depfile_path_)) {
+      depfile_path_ = fs::canonical(depfile_path_);
+   }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -370,31 +543,202 @@ void LimpApp::get_paths_(const S& pathspec) {
    }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Removes any paths from the input set which don't depend on any of
+/// the --affected-by paths, either directly or through another input whose
+/// output is itself a dependency.
+///
+/// \details Inputs containing LIMP comments which have no .limpdeps record
+/// (because they have never been processed with --hash) might depend on
+/// anything, so they are always considered affected.
+void LimpApp::select_affected_() {
+   std::unordered_map<S, std::vector<Path>> dependents;
+   std::set<Path> affected;
+   std::vector<Path> changed;
+   for (auto& p : paths_) {
+      if (fs::exists(dependency_record_path(p))) {
+         for (auto& dep : read_dependency_record(p)) {
+            dependents[dep.generic_string()].push_back(p);
+         }
+      } else {
+         LimpProcessor proc(p, comment_language_(p), langs_["!!"], Path());
+         proc.streaming(streaming_);
+         if (proc.processable()) {
+            be_short_warn() << "No dependency record; assuming affected: " << color::fg_yellow << p.generic_string() | default_log();
+            affected.insert(p);
+            changed.push_back(p);
+         }
+      }
+   }
+
+   for (auto& p : affected_by_) {
+      changed.push_back(fs::weakly_canonical(fs::absolute(p)));
+   }
+
+   while (!changed.empty()) {
+      Path p = std::move(changed.back());
+      changed.pop_back();
+
+      auto it = dependents.find(p.generic_string());
+      if (it == dependents.end()) {
+         continue;
+      }
+
+      for (auto& dependent : it->second) {
+         bool inserted = false;
+         std::tie(std::ignore, inserted) = affected.insert(dependent);
+         if (inserted) {
+            be_short_verbose() << "Affected: " << color::fg_gray << dependent.generic_string() | default_log();
+            changed.push_back(dependent);
+         }
+      }
+   }
+
+   paths_ = std::move(affected);
+   force_process_ = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LimpApp::parse_shard_(const S& str) {
+   std::size_t slash = str.find('/');
+   if (slash != S::npos) {
+      try {
+         std::size_t index_end, count_end;
+         unsigned long index = std::stoul(str.substr(0, slash), &index_end);
+         unsigned long count = std::stoul(str.substr(slash + 1), &count_end);
+         if (index_end == slash && count_end == str.size() - slash - 1 && index >= 1 && index <= count) {
+            shard_index_ = (U32)index;
+            shard_count_ = (U32)count;
+            return;
+         }
+      } catch (const std::logic_error&) { }
+   }
+
+   throw std::invalid_argument("Invalid --shard value '" + str + "'; expected K/N where 1 <= K <= N");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Determines the order in which input files will be processed, and
+/// if --shard was specified, which of them this process is responsible for.
+///
+/// \details Files are ordered longest-first, using the processing times
+/// recorded in their .limphash files, so that slow files start as early as
+/// possible.  Shards are assigned greedily: each file (in that order) goes to
+/// the shard with the least total cost so far.  Without --hash or --shard,
+/// files are processed in path order and no times are read.
+std::vector<Path> LimpApp::schedule_() {
+   std::vector<Path> result;
+   // without --hash there are no recorded times worth reading (and should_process() won't read them again)
+   if ((paths_.size() < 2 || !write_hashes_) && shard_count_ <= 1) {
+      result.assign(paths_.begin(), paths_.end());
+      return result;
+   }
+
+   struct Job {
+      const Path* path;
+      U64 cost;
+   };
+
+   std::vector<Job> jobs;
+   jobs.reserve(paths_.size());
+   U64 total_cost = 0;
+   std::size_t known_costs = 0;
+   for (auto& p : paths_) {
+      U64 cost = read_recorded_cost(p);
+      if (cost != 0) {
+         total_cost += cost;
+         ++known_costs;
+      }
+      jobs.push_back(Job { &p, cost });
+   }
+
+   U64 default_cost = known_costs > 0 ? std::max((U64)1, total_cost / known_costs) : 1;
+   for (auto& job : jobs) {
+      if (job.cost == 0) {
+         job.cost = default_cost;
+      }
+   }
+
+   // paths_ is sorted, and stable_sort keeps it that way for equal costs, so every shard sees the same order
+   std::stable_sort(jobs.begin(), jobs.end(), [](const Job& a, const Job& b) {
+      return a.cost > b.cost;
+   });
+
+   if (shard_count_ <= 1) {
+      for (auto& job : jobs) {
+         result.push_back(*job.path);
+      }
+      return result;
+   }
+
+   std::vector<U64> shard_costs(shard_count_, 0);
+   for (auto& job : jobs) {
+      std::size_t shard = std::min_element(shard_costs.begin(), shard_costs.end()) - shard_costs.begin();
+      shard_costs[shard] += job.cost;
+      if (shard + 1 == shard_index_) {
+         result.push_back(*job.path);
+      }
+   }
+
+   be_short_verbose() << "Shard " << shard_index_ << "/" << shard_count_ << ": " << result.size() << " of " << jobs.size() << " files" | default_log();
+   return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const LanguageConfig& LimpApp::comment_language_(const Path& path) {
+   S ext = path.extension().generic_string();
+   auto it = langs_.find(ext.empty() ? ext : ext.substr(1));
+   return (it == langs_.end()) ? langs_[""] : it->second;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void LimpApp::process_(const Path& path) {
+   ++metrics().files_considered;
    try {
       S lang = path.extension().generic_string().substr(1);
 
       be_short_verbose() << "Processing " << S(lang) << " file: " << color::fg_gray << path.generic_string() | default_log();
 
-      auto it = langs_.find(lang);
-      const auto& comment = (it == langs_.end()) ? langs_[""] : it->second;
+      const auto& comment = comment_language_(path);
       const auto& limp = langs_["!!"];
       LimpProcessor proc(path, comment, limp, depfile_path_);
+      proc.streaming(streaming_);
+      // other shards may be reading the recorded times concurrently; if they changed, shards could disagree on the partition
+      proc.record_cost(shard_count_ == 0 || record_costs_);
 
       if (!proc.processable()) {
          proc.clear_hash();
          return;
       }
 
-      if (proc.should_process() || force_process_) {
+      // files processed before --hash recorded dependencies need a record, or --affected-by can't find them
+      bool needs_dependency_record = write_hashes_ && !dry_run_ && !fs::exists(dependency_record_path(path));
+
+      if (proc.should_process() || force_process_ || needs_dependency_record) {
          Path current_cwd = util::cwd();
          Path new_cwd = path.parent_path();
          if (current_cwd != new_cwd) {
             util::cwd(new_cwd);
          }
 
-         if (proc.process()) {
+         std::unique_ptr<belua::Context> context;
+         S context_key;
+         if (reuse_contexts_) {
+            context_key = limprc_cache().find(new_cwd).limprc_path.string();
+            auto it = contexts_.find(context_key);
+            if (it != contexts_.end()) {
+               context = std::move(it->second);
+               contexts_.erase(it);
+            }
+         }
+
+         bool modified = proc.process(context);
+
+         if (reuse_contexts_) {
+            contexts_[context_key] = std::move(context);
+         }
+
+         if (modified) {
             if (dry_run_) {
                be_short_info() << "Out of date: " << color::fg_red << path.generic_string() | default_log();
             } else {
@@ -402,12 +746,16 @@ void LimpApp::process_(const Path& path) {
                proc.write();
                if (write_hashes_) {
                   proc.write_hash();
+                  proc.write_dependencies();
                }
             }
          } else {
             if (dry_run_) {
                be_short_info() << "Up to date: " << color::fg_green << path.generic_string() | default_log();
             } else {
+               if (write_hashes_) {
+                  proc.write_dependencies();
+               }
                if (write_hashes_ && proc.write_hash()) {
                   be_short_verbose() << "Hash update: " << color::fg_green << path.generic_string() | default_log();
                } else {
@@ -0,0 +1,141 @@
+#include "limp_c.h"
+#include "limp_session.hpp"
+#include <be/core/lifecycle.hpp>
+#include <cstddef>
+#include <exception>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace be::limp {
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+// Hosts using the C interface don't know about bengine, so the lifecycles
+// are started when the first session is created and live until exit.
+void ensure_runtime() {
+   static CoreInitLifecycle init;
+   static CoreLifecycle core;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Copying the message may itself fail; the result is still marked as failed.
+template <typename Result>
+void set_error(Result& result, const char* msg) noexcept {
+   result.failed = true;
+   try {
+      result.error = msg;
+   } catch (...) { }
+}
+
+// Size of limp_language as first published; newer fields must be checked
+// against struct_size before being read.
+constexpr std::size_t limp_language_v1_size = offsetof(limp_language, limp_closer) + sizeof(const char*);
+
+} // be::limp::()
+} // be::limp
+
+struct limp_session {
+   explicit limp_session(unsigned flags)
+      : session((flags & LIMP_SESSION_REUSE_CONTEXTS) != 0, (flags & LIMP_SESSION_CHANGE_DIRECTORY) != 0) { }
+
+   be::limp::LimpSession session;
+};
+
+struct limp_result {
+   be::limp::SessionResult result;
+   std::vector<be::S> dependencies;
+   be::S error;
+   bool failed = false;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+limp_session* limp_session_create(unsigned flags) {
+   try {
+      be::limp::ensure_runtime();
+      return new limp_session(flags);
+   } catch (...) {
+      return nullptr;
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void limp_session_clear_contexts(limp_session* session) {
+   if (session) {
+      session->session.clear_contexts();
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void limp_session_destroy(limp_session* session) {
+   delete session;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+limp_result* limp_process(limp_session* session, const char* content, size_t content_length, const char* path, const limp_language* language) {
+   using namespace be;
+   using namespace be::limp;
+
+   limp_result* result = new (std::nothrow) limp_result();
+   if (!result) {
+      return nullptr;
+   }
+
+   try {
+      if (!session || !path || !language || language->struct_size < limp_language_v1_size ||
+          !language->comment_opener || !language->comment_closer || (!content && content_length > 0)) {
+         throw std::invalid_argument("Invalid argument passed to limp_process()");
+      }
+
+      LanguageConfig comment { language->comment_opener, language->comment_closer };
+      LanguageConfig limp {
+         language->limp_opener ? S(language->limp_opener) : S("!!"),
+         language->limp_closer ? S(language->limp_closer) : S("!!")
+      };
+
+      result->result = session->session.process(S(content ? content : "", content_length), fs::u8path(path), comment, limp);
+
+      result->dependencies.reserve(result->result.dependencies.size());
+      for (const Path& dep : result->result.dependencies) {
+         result->dependencies.push_back(dep.generic_string());
+      }
+   } catch (const std::exception& e) {
+      set_error(*result, e.what());
+   } catch (...) {
+      set_error(*result, "Unknown error");
+   }
+   return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* limp_result_error(const limp_result* result) {
+   return result->failed ? result->error.c_str() : nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int limp_result_modified(const limp_result* result) {
+   return result->result.modified ? 1 : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* limp_result_output(const limp_result* result, size_t* length) {
+   if (length) {
+      *length = result->result.output.size();
+   }
+   return result->result.output.c_str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+size_t limp_result_dependency_count(const limp_result* result) {
+   return result->dependencies.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+const char* limp_result_dependency(const limp_result* result, size_t index) {
+   return index < result->dependencies.size() ? result->dependencies[index].c_str() : nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void limp_result_destroy(limp_result* result) {
+   delete result;
+}
@@ -1,11 +1,13 @@
 #include "limp_processor.hpp"
 #include "limp_lua.hpp"
+#include "lua_modules.hpp"
+#include "include_index.hpp"
+#include "atomic_file.hpp"
+#include "metrics.hpp"
 #include <be/core/logging.hpp>
 #include <be/util/zlib.hpp>
 #include <be/util/get_file_contents.hpp>
-#include <be/util/put_file_contents.hpp>
 #include <be/util/fnv.hpp>
-#include <be/util/line_endings.hpp>
 #include <be/belua/lua_helpers.hpp>
 #include <be/core/lua_modules.hpp>
 #include <be/util/lua_modules.hpp>
@@ -15,10 +17,120 @@
 #include <lua/lualib.h>
 #include <lua/lauxlib.h>
 #include <sstream>
+#include <fstream>
+#include <deque>
+#include <future>
+#include <thread>
+#include <chrono>
+#include <limits>
+#include <mutex>
 
 namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+// Provides a window onto the unconsumed part of a source file.  When
+// constructed from a string, the whole file is always visible.  When
+// constructed from a stream, only the data read so far (minus anything
+// consumed) is visible, and fill() must be called to see more.
+class SourceBuffer final {
+public:
+   explicit SourceBuffer(SV content)
+      : view_(content),
+        stream_(nullptr),
+        chunk_size_(0),
+        offset_(0) { }
+
+   SourceBuffer(std::istream& is, std::size_t chunk_size)
+      : stream_(&is),
+        chunk_size_(chunk_size),
+        offset_(0) { }
+
+   SV view() const {
+      if (stream_) {
+         return SV(buf_).substr(offset_);
+      }
+      return view_;
+   }
+
+   bool fill() {
+      if (!stream_ || !*stream_) {
+         return false;
+      }
+
+      if (offset_ > 0) {
+         buf_.erase(0, offset_);
+         offset_ = 0;
+      }
+
+      std::size_t old_size = buf_.size();
+      buf_.resize(old_size + chunk_size_);
+      stream_->read(&buf_[old_size], chunk_size_);
+      std::size_t n = (std::size_t)stream_->gcount();
+      buf_.resize(old_size + n);
+      return n > 0;
+   }
+
+   void consume(std::size_t n) {
+      if (stream_) {
+         offset_ += n;
+      } else {
+         view_.remove_prefix(n);
+      }
+   }
+
+private:
+   SV view_;
+   std::istream* stream_;
+   std::size_t chunk_size_;
+   std::size_t offset_;
+   S buf_;
+};
+
 namespace {
 
+constexpr std::size_t stream_chunk_size = 1 << 20;
+
+// Isolated comments create contexts on worker threads.  The bengine Lua
+// modules and .limprc scripts (which register templates, log, and intern
+// IDs) aren't known to be safe to set up concurrently, so contexts are
+// created one at a time; only the comments themselves run concurrently.
+std::mutex context_creation_mutex;
+
+///////////////////////////////////////////////////////////////////////////////
+// Hashes data incrementally by chaining the FNV hashes of fixed-size chunks.
+// The result depends only on the data, not on how it was split up by
+// append(), but it is not the same as hashing the data all at once.
+class ChunkedHash final {
+public:
+   void append(SV data) {
+      while (!data.empty()) {
+         std::size_t n = std::min(data.size(), stream_chunk_size - pending_.size());
+         pending_.append(data.substr(0, n));
+         data.remove_prefix(n);
+         if (pending_.size() == stream_chunk_size) {
+            flush_();
+         }
+      }
+   }
+
+   S finish() {
+      if (!pending_.empty() || hash_.empty()) {
+         flush_();
+      }
+      return hash_;
+   }
+
+private:
+   void flush_() {
+      hash_.append(pending_);
+      hash_ = util::fnv256_1a(hash_);
+      pending_.clear();
+   }
+
+   S hash_;
+   S pending_;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 S inflate_limp_core() {
 #ifdef BE_LIMP_COMPILED_LUA_MODULE_UNCOMPRESSED_LENGTH
@@ -36,23 +148,114 @@ SV get_limp_core() {
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-int lua_get_results(lua_State* L) {
-   lua_getglobal(L, "reset");
+FinishedOutput get_results(belua::Context& context) {
+   FinishedOutput result;
+
+   lua_State* L = context.L();
+   lua_pushcfunction(L, lua_finish_output);
+   lua_pushlightuserdata(L, &result);
+   belua::ecall(L, 1, 0);
+   return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int lua_get_dependencies(lua_State* L) {
+   lua_getglobal(L, "get_dependencies");
    lua_call(L, 0, 1);
    return 1;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-S get_results(belua::Context& context) {
-   SV result;
+std::vector<S> get_dependencies(belua::Context& context) {
+   std::vector<S> deps;
 
    lua_State* L = context.L();
-   lua_pushcfunction(L, lua_get_results);
+   lua_pushcfunction(L, lua_get_dependencies);
    belua::ecall(L, 0, 1);
-   SV raw = belua::get_string_view(L, -1, SV());
-   return util::normalize_newlines_copy(raw);
+   lua_Integer n = (lua_Integer)lua_rawlen(L, -1);
+   for (lua_Integer i = 1; i <= n; ++i) {
+      lua_rawgeti(L, -1, i);
+      deps.push_back(S(belua::get_string_view(L, -1, SV())));
+      lua_pop(L, 1);
+   }
+   lua_pop(L, 1);
+   return deps;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void add_dependencies(belua::Context& context, const std::vector<S>& deps) {
+   lua_State* L = context.L();
+   for (const S& dep : deps) {
+      lua_getglobal(L, "dependency");
+      belua::push_string(L, dep);
+      belua::ecall(L, 1, 0);
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Converts the dependencies recorded by a LIMP context (which are
+/// relative to root_dir) to canonical absolute paths.
+std::vector<Path> get_absolute_dependencies(belua::Context& context) {
+   std::vector<Path> deps;
+
+   lua_State* L = context.L();
+   lua_getglobal(L, "root_dir");
+   Path root_dir(S(belua::get_string_view(L, -1, SV())));
+   lua_pop(L, 1);
+
+   for (const S& dep : get_dependencies(context)) {
+      Path path = fs::absolute(root_dir / Path(dep));
+      std::error_code ec;
+      Path canonical = fs::weakly_canonical(path, ec);
+      deps.push_back(ec ? path.lexically_normal() : canonical);
+   }
+   return deps;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Determines if a LIMP program starts with the --isolated pragma.
+///
+/// \details Isolated programs promise not to depend on any state left behind
+/// by earlier LIMP comments in the same file, so they can be executed in a
+/// separate context, concurrently with the rest of the file.
+bool is_isolated(SV program) {
+   using namespace std::literals::string_view_literals;
+   constexpr SV pragma = "--isolated"sv;
+
+   std::size_t begin = program.find_first_not_of(" \t\r\n");
+   if (begin == SV::npos) {
+      return false;
+   }
+
+   program.remove_prefix(begin);
+   if (program.substr(0, pragma.size()) != pragma) {
+      return false;
+   }
+
+   if (program.size() == pragma.size()) {
+      return true;
+   }
+
+   char c = program[pragma.size()];
+   return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct IsolatedResult {
+   FinishedOutput new_gen;
+   std::vector<S> dependencies;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Output that can't be written yet because an earlier isolated LIMP comment
+// is still executing.  If result is valid, text is the comment's program,
+// otherwise it is literal text to be output.
+struct PendingOutput {
+   S text;
+   S old_gen;
+   std::future<IsolatedResult> result;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 void set_global(belua::Context& context, const char* field, SV value) {
    lua_State* L = context.L();
@@ -60,6 +263,33 @@ void set_global(belua::Context& context, const char* field, SV value) {
    lua_setglobal(L, field);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// .limphash files contain the hash of the processed file on the first line,
+// and optionally the time it took to process, in microseconds, on the second.
+struct HashRecord {
+   S hash;
+   U64 cost = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+HashRecord parse_hash_record(const S& contents) {
+   HashRecord record;
+   std::istringstream iss(contents);
+   std::getline(iss, record.hash);
+   boost::trim(record.hash);
+
+   S cost;
+   if (std::getline(iss, cost)) {
+      boost::trim(cost);
+      try {
+         record.cost = std::stoull(cost);
+      } catch (const std::exception&) {
+         record.cost = 0;
+      }
+   }
+   return record;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void set_global(belua::Context& context, const char* field, lua_Integer value) {
    lua_State* L = context.L();
@@ -73,20 +303,94 @@ void set_global(belua::Context& context, const char* field, lua_Integer value) {
 LimpProcessor::LimpProcessor(const Path& path, const LanguageConfig& comment, const LanguageConfig& limp, const Path& depfile_path)
    : path_(path),
      hash_path_(path.string() + ".limphash"),
+     deps_path_(dependency_record_path(path)),
      depfile_path_(depfile_path),
+     temp_path_(unique_temp_path(path)),
      comment_(comment),
      limp_(limp),
+     in_memory_(false),
+     streaming_(false),
      loaded_(false),
      processable_calculated_(false),
      processable_(false) { }
 
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Constructs a processor for an in-memory buffer.
+///
+/// \details The path is used to set up the LIMP environment (e.g. to find
+/// the .limprc file and resolve relative paths) but the file itself is never
+/// read or written; write(), write_hash(), write_dependencies(), and
+/// clear_hash() do nothing.  Use processed_content() to retrieve the output.
+LimpProcessor::LimpProcessor(const Path& path, S content, const LanguageConfig& comment, const LanguageConfig& limp)
+   : path_(path),
+     comment_(comment),
+     limp_(limp),
+     disk_content_hash_(util::fnv256_1a(content)),
+     disk_content_(std::move(content)),
+     in_memory_(true),
+     streaming_(false),
+     loaded_(true),
+     processable_calculated_(false),
+     processable_(false) { }
+
+///////////////////////////////////////////////////////////////////////////////
+LimpProcessor::~LimpProcessor() {
+   if (streaming_) {
+      std::error_code ec;
+      fs::remove(temp_path_, ec);
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool LimpProcessor::streaming() const {
+   return streaming_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Enables or disables bounded-memory processing.
+///
+/// \details When streaming, the source file is never held in memory all at
+/// once.  It is read in chunks, LIMP comments are executed as they are found,
+/// and output is written to a temporary file which replaces the source when
+/// write() is called.  Peak memory use is then proportional to the largest
+/// single LIMP comment (including its generated lines) rather than the file.
+/// The file_contents global is not available to LIMP scripts in this mode,
+/// and the hashes written to .limphash files are computed differently, so
+/// switching modes will cause files to be reprocessed once.
+///
+/// Must be called before any other member function.
+void LimpProcessor::streaming(bool enabled) {
+   streaming_ = enabled && !in_memory_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool LimpProcessor::record_cost() const {
+   return record_cost_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Determines whether write_hash() saves the time taken by
+/// process().
+///
+/// \details When disabled, any previously recorded time is kept as-is.
+/// Enabled by default.
+void LimpProcessor::record_cost(bool enabled) {
+   record_cost_ = enabled;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 bool LimpProcessor::processable() {
+   if (streaming_) {
+      scan_();
+      return processable_;
+   }
+
    load_();
    if (!processable_calculated_) {
       S search_str = comment_.opener + limp_.opener;
       if (S::npos != disk_content_.find(search_str)) {
          processable_ = true;
+         ++metrics().files_processable;
       }
       processable_calculated_ = true;
    }
@@ -99,11 +403,24 @@ bool LimpProcessor::should_process() {
       return false;
    }
 
-   if (fs::exists(hash_path_)) {
-      disk_hash_ = util::get_file_contents_string(hash_path_);
-      boost::trim(disk_hash_);
-      disk_content_hash_ = util::fnv256_1a(disk_content_);
-      return disk_hash_ != disk_content_hash_;
+   if (!in_memory_ && fs::exists(hash_path_)) {
+      S contents;
+      {
+         MetricsTimer timer(metrics().io_ns);
+         contents = util::get_file_contents_string(hash_path_);
+         metrics().bytes_read += contents.size();
+      }
+      HashRecord record = parse_hash_record(contents);
+      disk_hash_ = std::move(record.hash);
+      disk_cost_ = record.cost;
+      if (!streaming_) {
+         disk_content_hash_ = util::fnv256_1a(disk_content_);
+      }
+      if (disk_hash_ == disk_content_hash_) {
+         ++metrics().files_unchanged;
+         return false;
+      }
+      return true;
    } else {
       return true;
    }
@@ -111,96 +428,442 @@ bool LimpProcessor::should_process() {
 
 ///////////////////////////////////////////////////////////////////////////////
 bool LimpProcessor::process() {
+   std::unique_ptr<belua::Context> context;
+   return process(context);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Processes the file using a warm context, if one is provided.
+///
+/// \details If context is null, a new context is created for this file and
+/// stored in it, so that it can be passed to another LimpProcessor later.
+/// Otherwise the existing context is reset with begin_file() instead of
+/// reloading the LIMP core and .limprc.  Only the per-file state the core
+/// knows about is reset; any other globals set by earlier files remain, so
+/// contexts should only be reused for files that share a .limprc.
+bool LimpProcessor::process(std::unique_ptr<belua::Context>& context) {
+   auto start = std::chrono::steady_clock::now();
+   bool modified_file = process_file_(context);
+   auto elapsed = std::chrono::steady_clock::now() - start;
+   cost_ = std::max((U64)1, (U64)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+
+   ++metrics().files_processed;
+   if (modified_file) {
+      ++metrics().files_modified;
+   }
+   return modified_file;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Retrieves the time taken by the last call to process(), in
+/// microseconds, or 0 if process() hasn't been called.
+U64 LimpProcessor::cost() const {
+   return cost_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool LimpProcessor::process_file_(std::unique_ptr<belua::Context>& context) {
+   // include directories may have changed since the last file was processed
+   include_index().next_generation();
+
+   if (context) {
+      ++metrics().contexts_reused;
+      begin_file_(*context);
+   } else {
+      context = std::make_unique<belua::Context>(make_context_());
+   }
+
+   if (streaming_) {
+      std::ifstream ifs;
+      ifs.exceptions(std::ios_base::goodbit);
+      ifs.open(path_.native());
+      if (!ifs) {
+         throw fs::filesystem_error("Could not open file for reading", path_, std::make_error_code(std::errc::io_error));
+      }
+
+      std::ofstream ofs;
+      ofs.exceptions(std::ios_base::goodbit);
+      ofs.open(temp_path_.native(), std::ios_base::out | std::ios_base::trunc);
+      if (!ofs) {
+         throw fs::filesystem_error("Could not open file for writing", temp_path_, std::make_error_code(std::errc::io_error));
+      }
+
+      SourceBuffer source(ifs, stream_chunk_size);
+      bool modified_file = process_(source, ofs, *context);
+
+      ofs.close();
+      if (!ofs || ifs.bad()) {
+         throw fs::filesystem_error("Error while streaming file", path_, std::make_error_code(std::errc::io_error));
+      }
+
+      return modified_file;
+   }
+
+   load_();
+   SourceBuffer source(disk_content_);
+   std::ostringstream oss;
+   bool modified_file = process_(source, oss, *context);
+   processed_content_ = oss.str();
+   return modified_file;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LimpProcessor::write() {
+   if (in_memory_) {
+      return;
+   }
+
+   MetricsTimer timer(metrics().io_ns);
+   if (streaming_) {
+      metrics().bytes_written += (U64)fs::file_size(temp_path_);
+      replace_file(temp_path_, path_);
+   } else {
+      metrics().bytes_written += processed_content_.size();
+      put_file_contents_atomic(path_, processed_content_);
+   }
+   ++metrics().files_written;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Retrieves the absolute paths of all scripts, templates, and other
+/// files used while generating output during the last call to process().
+const std::vector<Path>& LimpProcessor::dependencies() const {
+   return dependencies_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Retrieves the output of the last call to process(), unless
+/// streaming is enabled.
+const S& LimpProcessor::processed_content() const {
+   return processed_content_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LimpProcessor::clear_hash() {
+   if (in_memory_) {
+      return;
+   }
+
+   if (fs::exists(hash_path_)) {
+      fs::remove(hash_path_);
+   }
+   if (fs::exists(deps_path_)) {
+      fs::remove(deps_path_);
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool LimpProcessor::write_hash() {
+   if (in_memory_) {
+      return false;
+   }
+
+   S processed_content_hash = streaming_ ? processed_content_hash_ : util::fnv256_1a(processed_content_);
+   bool hash_changed = processed_content_hash != disk_hash_;
+
+   // Small variations in timing aren't worth rewriting the record for
+   U64 cost = (record_cost_ && cost_ != 0) ? cost_ : disk_cost_;
+   bool cost_changed = record_cost_ && cost != 0 && (disk_cost_ == 0 || cost * 4 < disk_cost_ * 3 || cost * 4 > disk_cost_ * 5);
+
+   if (hash_changed || cost_changed) {
+      S record = processed_content_hash;
+      if (cost != 0) {
+         record.push_back('\n');
+         record.append(std::to_string(cost));
+      }
+      MetricsTimer timer(metrics().io_ns);
+      put_file_contents_atomic(hash_path_, record);
+      metrics().bytes_written += record.size();
+      ++metrics().hashes_written;
+   }
+   return hash_changed;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Saves the dependencies found during the last call to process() to
+/// the file's .limpdeps record, so that later runs can determine which
+/// files are affected by a change to a dependency without processing them.
+///
+/// \returns true if the record was changed.
+bool LimpProcessor::write_dependencies() {
+   if (in_memory_) {
+      return false;
+   }
+
+   S record;
+   for (const Path& dep : dependencies_) {
+      record.append(dep.generic_string());
+      record.push_back('\n');
+   }
+
+   MetricsTimer timer(metrics().io_ns);
+   if (fs::exists(deps_path_) && util::get_file_contents_string(deps_path_) == record) {
+      return false;
+   }
+
+   put_file_contents_atomic(deps_path_, record);
+   metrics().bytes_written += record.size();
+   ++metrics().dependency_records_written;
+   return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LimpProcessor::load_() {
+   if (!loaded_) {
+      MetricsTimer timer(metrics().io_ns);
+      disk_content_ = util::get_text_file_contents_string(path_);
+      metrics().bytes_read += disk_content_.size();
+      ++metrics().files_scanned;
+      loaded_ = true;
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LimpProcessor::scan_() {
+   if (loaded_) {
+      return;
+   }
+
+   MetricsTimer timer(metrics().io_ns);
+   std::ifstream ifs;
+   ifs.exceptions(std::ios_base::goodbit);
+   ifs.open(path_.native());
+   if (!ifs) {
+      throw fs::filesystem_error("Could not open file for reading", path_, std::make_error_code(std::errc::io_error));
+   }
+
+   const S opener = comment_.opener + limp_.opener;
+   SourceBuffer source(ifs, stream_chunk_size);
+   ChunkedHash hash;
+
+   while (source.fill()) {
+      SV data = source.view();
+      if (!processable_ && S::npos != data.find(opener)) {
+         processable_ = true;
+         ++metrics().files_processable;
+      }
+
+      // keep enough to find an opener that straddles two chunks
+      std::size_t keep = std::min(data.size(), opener.size() - 1);
+      hash.append(data.substr(0, data.size() - keep));
+      metrics().bytes_read += data.size() - keep;
+      source.consume(data.size() - keep);
+   }
+   hash.append(source.view());
+   metrics().bytes_read += source.view().size();
+   ++metrics().files_scanned;
+
+   if (ifs.bad()) {
+      throw fs::filesystem_error("Error while reading file", path_, std::make_error_code(std::errc::io_error));
+   }
+
+   disk_content_hash_ = hash.finish();
+   processable_calculated_ = true;
+   loaded_ = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool LimpProcessor::process_(SourceBuffer& source, std::ostream& os, belua::Context& context) {
    using namespace std::literals::string_view_literals;
 
    bool modified_file = false; // set to true if we find stuff that needs to be replaced
 
    I32 limp_comment_number = 1;
-   belua::Context context = make_context_();
 
-   SV remaining = disk_content_;
-   S opener = comment_.opener + limp_.opener;
-   std::ostringstream oss;
+   const S opener = comment_.opener + limp_.opener;
+   const std::size_t max_closer_size = std::max(limp_.closer.size(), comment_.closer.size());
+
+   ChunkedHash output_hash;
+   auto write_out = [&](SV text) {
+      os << text;
+      if (streaming_) {
+         output_hash.append(text);
+      }
+   };
+
+   std::deque<PendingOutput> pending;
+   std::size_t pending_isolated = 0;
+   std::size_t pending_bytes = 0;
+   const std::size_t max_pending_isolated = std::max(1u, std::thread::hardware_concurrency());
+   // when streaming, text queued behind an unfinished isolated comment must not grow without bound
+   const std::size_t max_pending_bytes = streaming_ ? 4 * stream_chunk_size : std::numeric_limits<std::size_t>::max();
+
+   S line_tail; // everything output since the last newline
+   auto emit = [&](SV text) {
+      if (pending.empty()) {
+         write_out(text);
+      } else {
+         if (pending.back().result.valid()) {
+            pending.emplace_back();
+         }
+         pending.back().text.append(text);
+         pending_bytes += text.size();
+      }
 
-   const char limp_closer_initial_char = limp_.closer.front();
-   const char comment_closer_initial_char = comment_.closer.front();
+      std::size_t last_nl = text.rfind('\n'); // not checking for \r because we should have opened the file in text mode
+      if (last_nl == SV::npos) {
+         line_tail.append(text);
+      } else {
+         line_tail.assign(text.substr(last_nl + 1));
+      }
+   };
+
+   auto emit_limp = [&](auto&& out, SV program, const FinishedOutput& new_gen) {
+      std::size_t lines = 1 + new_gen.newlines;
+      out(program);
+      out(limp_.closer);
+      out(" "sv);
+      out(std::to_string(lines));
+      out(" "sv);
+      out(comment_.closer);
+      out(new_gen.text);
+      out("\n"sv);
+   };
+
+   // Writes pending output in source order, up to the first isolated LIMP comment that hasn't
+   // finished executing.  If wait is true, too many isolated comments are in flight, or too much
+   // output is queued behind them, waits for them to finish.
+   auto flush_pending = [&](bool wait) {
+      while (!pending.empty()) {
+         PendingOutput& front = pending.front();
+         if (front.result.valid()) {
+            if (!wait && pending_isolated < max_pending_isolated && pending_bytes < max_pending_bytes &&
+                front.result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+               break;
+            }
+
+            IsolatedResult result = front.result.get();
+            --pending_isolated;
+            add_dependencies(context, result.dependencies);
+            emit_limp(write_out, front.text, result.new_gen);
+            if (front.old_gen != result.new_gen.text) {
+               modified_file = true;
+            }
+         } else {
+            write_out(front.text);
+         }
+         pending_bytes -= front.text.size();
+         pending.pop_front();
+      }
+   };
 
    for (;;) {
-      auto opener_begin = remaining.find(opener);
+      SV remaining;
+      std::size_t opener_begin;
+      for (;;) {
+         remaining = source.view();
+         opener_begin = remaining.find(opener);
+         if (opener_begin != SV::npos) {
+            break;
+         }
+
+         // only the last few characters could be the beginning of an opener
+         std::size_t keep = std::min(remaining.size(), opener.size() - 1);
+         emit(remaining.substr(0, remaining.size() - keep));
+         source.consume(remaining.size() - keep);
+         flush_pending(false);
+
+         if (!source.fill()) {
+            break;
+         }
+      }
+
       if (opener_begin == SV::npos) {
          break;
       }
 
       // Found a limp!
-      SV prefix = remaining.substr(0, opener_begin);
-      oss << prefix;
-      oss << opener;
-      remaining.remove_prefix(opener_begin + opener.size());
-
-      // determine indent string for each generated line
-      SV indent = prefix;
-      std::size_t prev_nl = prefix.rfind('\n'); // not checking for \r because we should have opened the file in text mode
-      if (prev_nl != SV::npos) {
-         indent.remove_prefix(prev_nl + 1);
-      }
+      emit(remaining.substr(0, opener_begin));
+      const S indent = line_tail; // indent string for each generated line
+      emit(opener);
+      source.consume(opener_begin + opener.size());
 
-      // find limp program and number of previously generated lines, followed by comment closer, and remove it from remaining
+      // find limp program and number of previously generated lines, followed by comment closer.
+      // Positions are offsets into source.view(), which may be reallocated by fill(), so views
+      // into it aren't taken until the whole LIMP comment and any old generated lines are buffered.
+      std::size_t program_end;
+      std::size_t block_end; // first character after the comment closer
       std::size_t lines = 0;
-      SV program = remaining;
-      for (auto it = remaining.begin(), end = remaining.end(); it != end; ++it) {
-         char c = *it;
-         if (c == limp_closer_initial_char) {
-            if (limp_.closer == remaining.substr(it - remaining.begin(), limp_.closer.size())) {
-               // found limp closer, check line count
-               program.remove_suffix(end - it);
-               remaining.remove_prefix((it - remaining.begin()) + limp_.closer.size());
-
-               SV linespec = remaining;
-
-               auto comment_close_begin = remaining.find(comment_.closer);
-               if (comment_close_begin == SV::npos) {
-                  // no comment closer
-                  remaining = SV();
-               } else {
-                  linespec.remove_suffix(linespec.size() - comment_close_begin);
-                  remaining.remove_prefix(comment_close_begin + comment_.closer.size());
-               }
+      bool found_limp_closer = false;
+      std::size_t search_begin = 0;
+      for (;;) {
+         remaining = source.view();
+         std::size_t limp_closer_begin = remaining.find(limp_.closer, search_begin);
+         std::size_t comment_closer_begin = remaining.find(comment_.closer, search_begin);
+         program_end = std::min(limp_closer_begin, comment_closer_begin);
+         if (program_end == SV::npos || program_end + max_closer_size > remaining.size()) {
+            // a longer closer might still begin earlier, once we can see all of it
+            std::size_t old_size = remaining.size();
+            if (source.fill()) {
+               search_begin = old_size > max_closer_size ? std::min(program_end, old_size - max_closer_size) : 0;
+               continue;
+            }
+         }
+         found_limp_closer = program_end != SV::npos && program_end == limp_closer_begin;
+         break;
+      }
 
-               std::istringstream iss = std::istringstream(S(linespec));
-               iss >> lines;
+      if (program_end == SV::npos) {
+         // no closer at all; the rest of the file is the program, and is also left in place
+         program_end = remaining.size();
+         block_end = 0;
+      } else if (found_limp_closer) {
+         // found limp closer, check line count
+         std::size_t linespec_begin = program_end + limp_.closer.size();
+         std::size_t linespec_end;
+         search_begin = linespec_begin;
+         for (;;) {
+            remaining = source.view();
+            std::size_t comment_close_begin = remaining.find(comment_.closer, search_begin);
+            if (comment_close_begin != SV::npos) {
+               linespec_end = comment_close_begin;
+               block_end = comment_close_begin + comment_.closer.size();
                break;
             }
-         }
-         if (c == comment_closer_initial_char) {
-            if (comment_.closer == remaining.substr(it - remaining.begin(), comment_.closer.size())) {
-               // found comment closer, no line count
-               program.remove_suffix(end - it);
-               remaining.remove_prefix((it - remaining.begin()) + comment_.closer.size());
+
+            std::size_t old_size = remaining.size();
+            if (!source.fill()) {
+               // no comment closer
+               linespec_end = old_size;
+               block_end = old_size;
                break;
             }
+            search_begin = std::max(linespec_begin, old_size - std::min(old_size, comment_.closer.size() - 1));
          }
+
+         std::istringstream iss = std::istringstream(S(remaining.substr(linespec_begin, linespec_end - linespec_begin)));
+         iss >> lines;
+      } else {
+         // found comment closer, no line count
+         block_end = program_end + comment_.closer.size();
       }
 
-      // capture next `lines` lines from remaining into old_gen
-      SV old_gen;
+      // capture next `lines` lines into old_gen
+      std::size_t old_gen_end = block_end;
       if (lines > 0) {
-         std::size_t old_gen_end = 0;
+         search_begin = block_end;
          while (lines > 0) {
-            old_gen_end = remaining.find('\n', old_gen_end);
-            if (old_gen_end == SV::npos) {
+            remaining = source.view();
+            std::size_t nl = remaining.find('\n', search_begin);
+            if (nl == SV::npos) {
+               if (source.fill()) {
+                  continue;
+               }
+               old_gen_end = source.view().size();
                break;
             }
             --lines;
-            ++old_gen_end;
-         }
-         old_gen = remaining.substr(0, old_gen_end);
-         remaining.remove_prefix(old_gen.size());
-         if (!old_gen.empty() && old_gen.back() == '\n') {
-            old_gen.remove_suffix(1);
+            search_begin = nl + 1;
+            old_gen_end = search_begin;
          }
       }
 
-      prepare_(context, old_gen, indent);
+      remaining = source.view();
+      SV program = remaining.substr(0, program_end);
+      SV old_gen = remaining.substr(block_end, old_gen_end - block_end);
+      if (!old_gen.empty() && old_gen.back() == '\n') {
+         old_gen.remove_suffix(1);
+      }
 
       S limp_name;
       const S limp_path = path_.filename().string();
@@ -210,26 +873,64 @@ bool LimpProcessor::process() {
       limp_name.append(limp_path);
       limp_name.append(" LIMP "sv);
       limp_name.append(limp_number_str);
-
-      context.execute(program, limp_name);
       ++limp_comment_number;
 
-      S new_gen = get_results(context);
-      lines = 1 + std::count(new_gen.begin(), new_gen.end(), '\n');
+      if (is_isolated(program)) {
+         PendingOutput isolated;
+         isolated.text = S(program);
+         isolated.old_gen = S(old_gen);
+         isolated.result = std::async(std::launch::async, [this, program = isolated.text, old_gen = isolated.old_gen, indent, limp_name]() {
+            belua::Context isolated_context = make_context_(false);
+            prepare_(isolated_context, old_gen, indent);
+            {
+               MetricsTimer timer(metrics().lua_ns);
+               isolated_context.execute(program, limp_name);
+            }
+            ++metrics().blocks_executed;
+            ++metrics().isolated_blocks_executed;
 
-      oss << program << limp_.closer << ' ' << lines << ' ' << comment_.closer << new_gen << '\n';
-      
-      if (old_gen != new_gen) {
-         modified_file = true;
+            IsolatedResult result;
+            result.new_gen = get_results(isolated_context);
+            result.dependencies = get_dependencies(isolated_context);
+            return result;
+         });
+
+         pending_bytes += isolated.text.size();
+         pending.push_back(std::move(isolated));
+         ++pending_isolated;
+         line_tail.clear();
+      } else {
+         prepare_(context, old_gen, indent);
+         {
+            MetricsTimer timer(metrics().lua_ns);
+            context.execute(program, limp_name);
+         }
+         ++metrics().blocks_executed;
+
+         FinishedOutput new_gen = get_results(context);
+         emit_limp(emit, program, new_gen);
+
+         if (old_gen != new_gen.text) {
+            modified_file = true;
+         }
       }
+
+      source.consume(old_gen_end);
+      flush_pending(false);
    }
 
-   oss << remaining;
+   emit(source.view());
+   flush_pending(true);
 
-   processed_content_ = oss.str();
+   if (streaming_) {
+      processed_content_hash_ = output_hash.finish();
+   }
+
+   dependencies_ = get_absolute_dependencies(context);
 
    if (!depfile_path_.empty()) {
       SV write_depfile = "if write_depfile then write_depfile() end"sv;
+      MetricsTimer timer(metrics().lua_ns);
       context.execute(write_depfile, "@" + path_.filename().string() + " write depfile");
    }
 
@@ -237,37 +938,12 @@ bool LimpProcessor::process() {
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-void LimpProcessor::write() {
-   util::put_text_file_contents(path_, processed_content_);
-}
-
-///////////////////////////////////////////////////////////////////////////////
-void LimpProcessor::clear_hash() {
-   if (fs::exists(hash_path_)) {
-      fs::remove(hash_path_);
-   }
-}
-
-///////////////////////////////////////////////////////////////////////////////
-bool LimpProcessor::write_hash() {
-   S processed_content_hash = util::fnv256_1a(processed_content_);
-   if (processed_content_hash != disk_hash_) {
-      util::put_text_file_contents(hash_path_, processed_content_hash);
-      return true;
-   }
-   return false;
-}
-
-///////////////////////////////////////////////////////////////////////////////
-void LimpProcessor::load_() {
-   if (!loaded_) {
-      disk_content_ = util::get_text_file_contents_string(path_);
-      loaded_ = true;
-   }
-}
-
-///////////////////////////////////////////////////////////////////////////////
-belua::Context LimpProcessor::make_context_() {
+/// \brief  Creates a context, loading the LIMP core and .limprc.
+///
+/// \details Contexts for isolated comments don't get the file_contents
+/// global, so that each one doesn't need its own copy of the whole file.
+belua::Context LimpProcessor::make_context_(bool with_file_contents) {
+   std::lock_guard<std::mutex> lock(context_creation_mutex);
    belua::Context context({
       belua::id_module,
       belua::logging_module,
@@ -281,18 +957,44 @@ belua::Context LimpProcessor::make_context_() {
       belua::blt_debug_module
    });
 
+   set_file_globals_(context, with_file_contents);
+
+   lua_State* L = context.L();
+   luaL_requiref(L, "be.limp", open_limp, 0);
+   lua_pop(L, 1);
+
+   {
+      MetricsTimer timer(metrics().lua_ns);
+      context.execute(get_limp_core(), "@LIMP core");
+   }
+   ++metrics().contexts_created;
+
+   return context;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LimpProcessor::begin_file_(belua::Context& context) {
+   using namespace std::literals::string_view_literals;
+   MetricsTimer timer(metrics().lua_ns);
+   context.execute("begin_file()"sv, "@" + path_.filename().string() + " begin file");
+   set_file_globals_(context);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void LimpProcessor::set_file_globals_(belua::Context& context, bool with_file_contents) {
    set_global(context, "file_path", path_.string());
    set_global(context, "file_dir", path_.parent_path().string());
    set_global(context, "file_hash", disk_content_hash_);
    set_global(context, "hash_file_path", hash_path_.string());
    set_global(context, "depfile_path", depfile_path_.string());
-   set_global(context, "file_contents", disk_content_);
+   if (!streaming_ && with_file_contents) {
+      set_global(context, "file_contents", disk_content_);
+   } else {
+      lua_pushnil(context.L());
+      lua_setglobal(context.L(), "file_contents");
+   }
    set_global(context, "comment_begin", comment_.opener);
    set_global(context, "comment_end", comment_.closer);
-
-   context.execute(get_limp_core(), "@LIMP core");
-
-   return context;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -301,4 +1003,48 @@ void LimpProcessor::prepare_(belua::Context& context, SV old_gen, SV indent) {
    set_global(context, "base_indent", indent);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+Path dependency_record_path(const Path& path) {
+   return Path(path.string() + ".limpdeps");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Reads the dependencies recorded for a source file by
+/// LimpProcessor::write_dependencies().
+///
+/// \details Returns an empty list if the file has never been processed with
+/// hashing enabled.
+std::vector<Path> read_dependency_record(const Path& path) {
+   std::vector<Path> deps;
+   Path record_path = dependency_record_path(path);
+   if (!fs::exists(record_path)) {
+      return deps;
+   }
+
+   std::istringstream iss(util::get_file_contents_string(record_path));
+   S line;
+   while (std::getline(iss, line)) {
+      boost::trim(line);
+      if (!line.empty()) {
+         deps.push_back(Path(line));
+      }
+   }
+   return deps;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Reads the processing time recorded in a file's .limphash, in
+/// microseconds.
+///
+/// \returns 0 if the file hasn't been processed with hashing enabled, or
+/// was last processed by a version of limp that didn't record timings.
+U64 read_recorded_cost(const Path& path) {
+   Path hash_path(path.string() + ".limphash");
+   std::error_code ec;
+   if (!fs::exists(hash_path, ec)) {
+      return 0;
+   }
+   return parse_hash_record(util::get_file_contents_string(hash_path)).cost;
+}
+
 } // be::limp
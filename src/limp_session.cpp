@@ -0,0 +1,104 @@
+#include "limp_session.hpp"
+#include "limp_processor.hpp"
+#include <be/util/paths.hpp>
+#include <mutex>
+
+namespace be::limp {
+namespace {
+
+///////////////////////////////////////////////////////////////////////////////
+// The working directory is process-wide, so sessions which change it take
+// turns.
+std::mutex& cwd_mutex() {
+   static std::mutex mutex;
+   return mutex;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Restores the previous working directory when destroyed.
+class CwdScope final {
+public:
+   explicit CwdScope(const Path& dir)
+      : lock_(cwd_mutex()),
+        old_(util::cwd()) {
+      changed_ = !dir.empty() && dir != old_ && fs::is_directory(dir);
+      if (changed_) {
+         util::cwd(dir);
+      }
+   }
+
+   ~CwdScope() {
+      if (changed_) {
+         util::cwd(old_);
+      }
+   }
+
+private:
+   std::lock_guard<std::mutex> lock_;
+   Path old_;
+   bool changed_;
+};
+
+} // be::limp::()
+
+///////////////////////////////////////////////////////////////////////////////
+LimpSession::LimpSession(bool reuse_contexts, bool change_directory)
+   : reuse_contexts_(reuse_contexts),
+     change_directory_(change_directory) { }
+
+///////////////////////////////////////////////////////////////////////////////
+LimpSession::~LimpSession() = default;
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Processes a buffer as if it were the contents of the file at path.
+///
+/// \details If the buffer doesn't contain any LIMP comments, it is returned
+/// unchanged without creating a Lua context.  Errors from LIMP scripts are
+/// thrown, as with LimpProcessor::process(); a context which was being
+/// reused when an error occurs is discarded.
+SessionResult LimpSession::process(S content, const Path& path, const LanguageConfig& comment, const LanguageConfig& limp) {
+   SessionResult result;
+
+   // same test as LimpProcessor::processable(), but without giving up the buffer
+   if (S::npos == content.find(comment.opener + limp.opener)) {
+      result.output = std::move(content);
+      return result;
+   }
+
+   Path absolute = fs::absolute(path);
+   LimpProcessor proc(absolute, std::move(content), comment, limp);
+
+   std::unique_ptr<CwdScope> cwd;
+   if (change_directory_) {
+      cwd = std::make_unique<CwdScope>(absolute.parent_path());
+   }
+
+   S key = absolute.parent_path().generic_string();
+   std::unique_ptr<belua::Context> context;
+   if (reuse_contexts_) {
+      auto it = contexts_.find(key);
+      if (it != contexts_.end()) {
+         context = std::move(it->second);
+         contexts_.erase(it);
+      }
+   }
+
+   result.modified = proc.process(context);
+   result.output = proc.processed_content();
+   result.dependencies = proc.dependencies();
+
+   if (reuse_contexts_) {
+      contexts_[key] = std::move(context);
+   }
+
+   return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Discards all warm contexts, e.g. after a .limprc file or include
+/// script has been edited.
+void LimpSession::clear_contexts() {
+   contexts_.clear();
+}
+
+} // be::limp
@@ -0,0 +1,56 @@
+#include "limprc_cache.hpp"
+#include <vector>
+
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Finds the nearest .limprc in dir or any of its ancestors.
+///
+/// \details Equivalent to the search originally done by import_limprc() in
+/// the LIMP core.  Every directory visited is cached with the result.
+LimprcLocation LimprcCache::find(const Path& dir) {
+   std::lock_guard<std::mutex> lock(mutex_);
+
+   std::vector<S> visited;
+   LimprcLocation result;
+   Path path = dir;
+   for (;;) {
+      S key = path.string();
+      auto it = locations_.find(key);
+      if (it != locations_.end()) {
+         result = it->second;
+         break;
+      }
+
+      visited.push_back(std::move(key));
+
+      Path limprc = path / ".limprc";
+      std::error_code ec;
+      if (fs::exists(limprc, ec)) {
+         result.limprc_path = limprc;
+         result.root_dir = path;
+         break;
+      }
+
+      Path parent = path.parent_path();
+      if (path.root_path() == path || parent.empty() || parent == path) {
+         result.root_dir = path;
+         break;
+      }
+      path = parent;
+   }
+
+   for (S& key : visited) {
+      locations_.emplace(std::move(key), result);
+   }
+
+   return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+LimprcCache& limprc_cache() {
+   static LimprcCache cache;
+   return cache;
+}
+
+} // be::limp
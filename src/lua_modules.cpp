@@ -0,0 +1,816 @@
+#include "lua_modules.hpp"
+#include "file_batch.hpp"
+#include "include_index.hpp"
+#include "output_buffer.hpp"
+#include "c_string_literal.hpp"
+#include "memo_store.hpp"
+#include "atomic_file.hpp"
+#include "limprc_cache.hpp"
+#include "metrics.hpp"
+#include <be/util/get_file_contents.hpp>
+#include <be/util/fnv.hpp>
+#include <be/belua/lua_helpers.hpp>
+#include <lua/lua.h>
+#include <lua/lauxlib.h>
+#include <new>
+
+namespace be::limp {
+namespace {
+
+constexpr const char* file_batch_metatable = "be.limp.FileBatch";
+constexpr const char* output_buffer_metatable = "be.limp.OutputBuffer";
+char output_buffer_key;
+
+///////////////////////////////////////////////////////////////////////////////
+// Calls fn, converting any std::exception it throws into a Lua error, so
+// that C++ exceptions never escape from a lua_CFunction.  The error is
+// raised only after the exception has been handled.
+template <typename F>
+int protect(lua_State* L, F&& fn) {
+   try {
+      return fn();
+   } catch (const std::exception& e) {
+      lua_pushstring(L, e.what());
+   }
+   return lua_error(L);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Whether a Lua error unwinds C++ frames depends on whether Lua was built
+// as C (longjmp, which skips destructors) or C++ (throw), so functions check
+// all of their arguments before constructing any C++ objects, and then do
+// their work inside protect().  check_paths() raises an error unless the
+// argument is a table of strings; to_paths() and to_string() then convert
+// already-checked arguments.
+void check_paths(lua_State* L, int index) {
+   luaL_checktype(L, index, LUA_TTABLE);
+   lua_Integer n = (lua_Integer)lua_rawlen(L, index);
+   for (lua_Integer i = 1; i <= n; ++i) {
+      int type = lua_rawgeti(L, index, i);
+      if (type != LUA_TSTRING && type != LUA_TNUMBER) {
+         luaL_error(L, "Expected path string at index %d", (int)i);
+      }
+      lua_pop(L, 1);
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<Path> to_paths(lua_State* L, int index) {
+   std::vector<Path> paths;
+   lua_Integer n = (lua_Integer)lua_rawlen(L, index);
+   paths.reserve((std::size_t)n);
+   for (lua_Integer i = 1; i <= n; ++i) {
+      lua_rawgeti(L, index, i);
+      std::size_t len;
+      const char* str = lua_tolstring(L, -1, &len);
+      paths.push_back(Path(S(str, len)));
+      lua_pop(L, 1);
+   }
+   return paths;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+S to_string(lua_State* L, int index) {
+   std::size_t len;
+   const char* str = lua_tolstring(L, index, &len);
+   return S(str, len);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+S check_string(lua_State* L, int index) {
+   luaL_checkstring(L, index);
+   return to_string(L, index);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+FileBatch& check_file_batch(lua_State* L, int index) {
+   return *static_cast<FileBatch*>(luaL_checkudata(L, index, file_batch_metatable));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Waits for a batch to complete, then pushes either a table of the
+/// contents of each file, or an error message if any could not be read.
+bool push_file_batch_contents(lua_State* L, FileBatch& batch) {
+   batch.wait();
+   for (std::size_t i = 0, n = batch.size(); i < n; ++i) {
+      const S& error = batch.error(i);
+      if (!error.empty()) {
+         belua::push_string(L, error);
+         return false;
+      }
+   }
+
+   lua_createtable(L, (int)batch.size(), 0);
+   for (std::size_t i = 0, n = batch.size(); i < n; ++i) {
+      metrics().bytes_read += batch.contents(i).size();
+      belua::push_string(L, batch.contents(i));
+      lua_rawseti(L, -2, (lua_Integer)(i + 1));
+   }
+   return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int file_batch_gc(lua_State* L) {
+   FileBatch& batch = check_file_batch(L, 1);
+   batch.~FileBatch();
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int file_batch_ready(lua_State* L) {
+   lua_pushboolean(L, check_file_batch(L, 1).ready());
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int file_batch_wait(lua_State* L) {
+   check_file_batch(L, 1).wait();
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int file_batch_contents(lua_State* L) {
+   if (!push_file_batch_contents(L, check_file_batch(L, 1))) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int limp_prefetch_files(lua_State* L) {
+   check_paths(L, 1);
+   return protect(L, [=]() {
+      std::vector<Path> paths = to_paths(L, 1);
+      void* ud = lua_newuserdata(L, sizeof(FileBatch));
+      new (ud) FileBatch(std::move(paths));
+      luaL_setmetatable(L, file_batch_metatable);
+      return 1;
+   });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int limp_read_files(lua_State* L) {
+   check_paths(L, 1);
+   bool ok = false;
+   protect(L, [&]() {
+      FileBatch batch(to_paths(L, 1));
+      ok = push_file_batch_contents(L, batch);
+      return 1;
+   });
+   if (!ok) {
+      return lua_error(L);
+   }
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  update_depfile(path, prefix, line)
+///
+/// \details Replaces the first rule in a makefile-style depfile that begins
+/// with prefix (the target followed by ':') with line, or appends line if
+/// there is no such rule.  The depfile may be shared by several limp
+/// processes running concurrently, so the read-modify-write is done while
+/// holding an advisory lock, and the new contents are renamed into place.
+int limp_update_depfile(lua_State* L) {
+   luaL_checkstring(L, 1);
+   luaL_checkstring(L, 2);
+   luaL_checkstring(L, 3);
+   return protect(L, [=]() {
+      Path path(to_string(L, 1));
+      S prefix = to_string(L, 2);
+      S line = to_string(L, 3);
+
+      Path parent = path.parent_path();
+      if (!parent.empty() && !fs::exists(parent)) {
+         fs::create_directories(parent);
+      }
+
+      FileLock lock(path);
+
+      S depfile;
+      if (fs::exists(path)) {
+         depfile = util::get_file_contents_string(path);
+      }
+
+      bool found_existing = false;
+      for (std::size_t pos = depfile.find(prefix); pos != S::npos; pos = depfile.find(prefix, pos + 1)) {
+         std::size_t begin = pos + prefix.size();
+         std::size_t end = depfile.find_first_of("\r\n", begin);
+         if (end == S::npos) {
+            end = depfile.size();
+         }
+         if (end > begin) {
+            depfile.replace(pos, end - pos, line);
+            found_existing = true;
+            break;
+         }
+      }
+
+      if (!found_existing) {
+         depfile.append(line);
+         depfile.push_back('\n');
+      }
+
+      put_file_contents_atomic(path, depfile, false);
+      return 0;
+   });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  read_file(path)
+///
+/// \details Equivalent to be.fs get_file_contents(), but counted in the
+/// bytes_read and io_seconds metrics.  Used for all file reads made by the
+/// LIMP core on behalf of scripts.
+int limp_read_file(lua_State* L) {
+   luaL_checkstring(L, 1);
+   return protect(L, [=]() {
+      S contents;
+      {
+         MetricsTimer timer(metrics().io_ns);
+         contents = util::get_file_contents_string(Path(to_string(L, 1)));
+      }
+      metrics().bytes_read += contents.size();
+      belua::push_string(L, contents);
+      return 1;
+   });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  find_limprc(dir)
+///
+/// \details Returns the path of the nearest .limprc in dir or its ancestors
+/// (or nil if there is none) and the directory that should be used as
+/// root_dir.  Results come from limprc_cache().
+int limp_find_limprc(lua_State* L) {
+   luaL_checkstring(L, 1);
+   return protect(L, [=]() {
+      LimprcLocation location = limprc_cache().find(Path(to_string(L, 1)));
+      if (location.limprc_path.empty()) {
+         lua_pushnil(L);
+      } else {
+         belua::push_string(L, location.limprc_path.string());
+      }
+      belua::push_string(L, location.root_dir.string());
+      return 2;
+   });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int limp_content_hash(lua_State* L) {
+   std::size_t len;
+   const char* str = luaL_checklstring(L, 1, &len);
+   belua::push_string(L, util::fnv256_1a(SV(str, len)));
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  memo_find(key)
+///
+/// \details Returns the output, indent delta, serialized results, and
+/// absolute dependency paths recorded for a pure call, or nil if no result
+/// has been stored for the key.
+int limp_memo_find(lua_State* L) {
+   S key = check_string(L, 1);
+   MemoStore::Entry entry;
+   if (!memo_store().find(key, entry)) {
+      ++metrics().memo_misses;
+      lua_pushnil(L);
+      return 1;
+   }
+
+   if (key.compare(0, 8, "include\0", 8) == 0) {
+      ++metrics().include_cache_hits;
+   } else if (key.compare(0, 9, "template\0", 9) == 0) {
+      ++metrics().template_cache_hits;
+   }
+
+   belua::push_string(L, entry.output);
+   lua_pushinteger(L, entry.indent_delta);
+   belua::push_string(L, entry.results);
+   lua_createtable(L, (int)entry.dependencies.size(), 0);
+   for (std::size_t i = 0; i < entry.dependencies.size(); ++i) {
+      belua::push_string(L, entry.dependencies[i]);
+      lua_rawseti(L, -2, (lua_Integer)i + 1);
+   }
+   return 4;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  memo_store(key, output, indent_delta, results, dependencies, root_dir)
+///
+/// \details Dependencies are provided relative to root_dir, as passed to
+/// dependency(), and stored as absolute paths so that they can be replayed
+/// by files with a different root_dir.
+int limp_memo_store(lua_State* L) {
+   luaL_checkstring(L, 1);
+   luaL_checkstring(L, 2);
+   lua_Integer indent_delta = luaL_checkinteger(L, 3);
+   luaL_checkstring(L, 4);
+   check_paths(L, 5);
+   const char* root_dir_str = luaL_optstring(L, 6, "");
+
+   return protect(L, [=]() {
+      S key = to_string(L, 1);
+      MemoStore::Entry entry;
+      entry.output = to_string(L, 2);
+      entry.indent_delta = (I32)indent_delta;
+      entry.results = to_string(L, 4);
+
+      std::vector<Path> deps = to_paths(L, 5);
+      Path root_dir(root_dir_str);
+      entry.dependencies.reserve(deps.size());
+      for (const Path& dep : deps) {
+         entry.dependencies.push_back(fs::absolute(root_dir / dep).lexically_normal().string());
+      }
+
+      memo_store().insert(key, std::move(entry));
+      ++metrics().memo_stores;
+      return 0;
+   });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  count_metric(name [, n])
+///
+/// \details Adds n (default 1) to the named counter in the metrics written
+/// by --metrics-out.  Unknown names are an error.
+int limp_count_metric(lua_State* L) {
+   std::size_t len;
+   const char* name = luaL_checklstring(L, 1, &len);
+   lua_Integer n = luaL_optinteger(L, 2, 1);
+   std::atomic<U64>* counter = find_metric(SV(name, len));
+   if (!counter) {
+      return luaL_error(L, "Unknown metric '%s'", name);
+   }
+   *counter += (U64)n;
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  c_string_literal(data [, line_length [, separator]])
+///
+/// \details Returns data escaped as one or more C string literals.  When
+/// line_length is nonzero, a new literal is started (after separator,
+/// default " \\\n") whenever the current one would exceed it.
+int limp_c_string_literal(lua_State* L) {
+   std::size_t len;
+   const char* str = luaL_checklstring(L, 1, &len);
+   lua_Integer line_length = luaL_optinteger(L, 2, 0);
+   std::size_t separator_len;
+   const char* separator = luaL_optlstring(L, 3, " \\\n", &separator_len);
+
+   S literal;
+   append_c_string_literal(literal, SV(str, len), (std::size_t)std::max(line_length, (lua_Integer)0), SV(separator, separator_len));
+   belua::push_string(L, literal);
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Looks up an include name in the shared include index.
+///
+/// \details Returns the path of the first match, false if there is
+/// definitely no match, or nil if the name can't be looked up in the index.
+int limp_find_include(lua_State* L) {
+   luaL_checkstring(L, 1);
+   check_paths(L, 2);
+   bool files_only = lua_toboolean(L, 3) != 0;
+
+   return protect(L, [=]() {
+      S name = to_string(L, 1);
+      std::vector<Path> dirs = to_paths(L, 2);
+
+      Path result;
+      switch (include_index().find(name, dirs, files_only, result)) {
+         case IncludeLookup::found:
+            belua::push_string(L, result.string());
+            break;
+         case IncludeLookup::not_found:
+            lua_pushboolean(L, 0);
+            break;
+         default:
+            lua_pushnil(L);
+            break;
+      }
+      return 1;
+   });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void register_file_batch(lua_State* L) {
+   luaL_Reg methods[] = {
+      { "ready", file_batch_ready },
+      { "wait", file_batch_wait },
+      { "contents", file_batch_contents },
+      { nullptr, nullptr }
+   };
+
+   luaL_newmetatable(L, file_batch_metatable);
+   luaL_newlib(L, methods);
+   lua_setfield(L, -2, "__index");
+   lua_pushcfunction(L, file_batch_gc);
+   lua_setfield(L, -2, "__gc");
+   lua_pop(L, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+OutputBuffer& upvalue_output_buffer(lua_State* L) {
+   return *static_cast<OutputBuffer*>(lua_touserdata(L, lua_upvalueindex(1)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void call_global(lua_State* L, const char* name) {
+   lua_getglobal(L, name);
+   lua_call(L, 0, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void start_output(lua_State* L, OutputBuffer& buf) {
+   if (!buf.started()) {
+      buf.start();
+      call_global(L, "write_prefix");
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SV global_string(lua_State* L, const char* name) {
+   lua_getglobal(L, name);
+   std::size_t len = 0;
+   const char* str = lua_type(L, -1) == LUA_TSTRING ? lua_tolstring(L, -1, &len) : nullptr;
+   lua_pop(L, 1); // the string is still referenced by _G
+   return str ? SV(str, len) : SV();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+S current_indent(lua_State* L, const OutputBuffer& buf) {
+   lua_getglobal(L, "indent_size");
+   I32 indent_size = (I32)lua_tointeger(L, -1);
+   lua_pop(L, 1);
+
+   S indent;
+   append_indent(indent, global_string(L, "base_indent"), global_string(L, "indent_char"), buf.indent() * indent_size);
+   return indent;
+}
+
+int output_nl(lua_State* L);
+int output_write_indent(lua_State* L);
+int output_reset(lua_State* L);
+
+///////////////////////////////////////////////////////////////////////////////
+// Determines if a global still refers to the native implementation, rather
+// than a replacement installed by .limprc or a LIMP comment.
+bool global_is_native(lua_State* L, const char* name, lua_CFunction fn) {
+   lua_getglobal(L, name);
+   bool native = lua_tocfunction(L, -1) == fn;
+   lua_pop(L, 1);
+   return native;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Equivalent to nl(): writes a newline, then calls write_indent().  When
+// check_nl is set (i.e. when called on behalf of writeln() or write_lines())
+// a replacement nl() is called instead.
+void append_nl(lua_State* L, OutputBuffer& buf, bool check_nl) {
+   if (check_nl && !global_is_native(L, "nl", output_nl)) {
+      call_global(L, "nl");
+      return;
+   }
+
+   buf.append("\n");
+   if (global_is_native(L, "write_indent", output_write_indent)) {
+      buf.append(current_indent(L, buf));
+   } else {
+      call_global(L, "write_indent");
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void append_args(lua_State* L, OutputBuffer& buf, int first, int last, bool nl_after_each) {
+   for (int i = first; i <= last; ++i) {
+      int type = lua_type(L, i);
+      if (type == LUA_TSTRING || type == LUA_TNUMBER) {
+         std::size_t len;
+         const char* str = lua_tolstring(L, i, &len);
+         buf.append(SV(str, len));
+      } else if (type != LUA_TNIL) {
+         luaL_error(L, "invalid value (at index %d) in write", i);
+      }
+
+      if (nl_after_each) {
+         append_nl(L, buf, true);
+      }
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Implements reset(): writes the postfix, takes the buffered
+/// output, and applies postprocess() to it.
+///
+/// \details When postprocess() is the default trim_trailing_ws(), trimming
+/// is done natively, in the same pass as newline normalization if newlines
+/// is non-null.
+S finish_output(lua_State* L, OutputBuffer& buf, std::size_t* newlines) {
+   start_output(L, buf);
+   call_global(L, "write_postfix");
+   S str = buf.take();
+
+   bool native_trim = false;
+   lua_getglobal(L, "postprocess");
+   if (lua_tocfunction(L, -1) == lua_trim_trailing_ws) {
+      // default postprocess; but respect trim_trailing_ws being replaced
+      lua_pop(L, 1);
+      lua_getglobal(L, "trim_trailing_ws");
+      native_trim = lua_tocfunction(L, -1) == lua_trim_trailing_ws;
+   }
+
+   if (!native_trim && lua_isfunction(L, -1)) {
+      belua::push_string(L, str);
+      lua_call(L, 1, 1);
+      str = S(belua::get_string_view(L, -1, SV()));
+   }
+   lua_pop(L, 1);
+
+   if (newlines) {
+      *newlines = normalize_output(str, native_trim);
+   } else if (native_trim) {
+      str = trim_trailing_ws(str);
+   }
+
+   return str;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_buffer_gc(lua_State* L) {
+   static_cast<OutputBuffer*>(luaL_checkudata(L, 1, output_buffer_metatable))->~OutputBuffer();
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_write(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   int n = lua_gettop(L);
+   start_output(L, buf);
+   append_args(L, buf, 1, n, false);
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_writeln(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   int n = lua_gettop(L);
+   start_output(L, buf);
+   append_args(L, buf, 1, n, false);
+   append_nl(L, buf, true);
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_write_lines(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   int n = lua_gettop(L);
+   start_output(L, buf);
+   append_args(L, buf, 1, n, true);
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_nl(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   start_output(L, buf);
+   append_nl(L, buf, false);
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_write_indent(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   S indent = current_indent(L, buf);
+   if (!indent.empty()) {
+      start_output(L, buf);
+      buf.append(indent);
+   }
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Equivalent to write(indent_newlines(str)), without creating an
+/// intermediate string.
+int output_write_indented(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   std::size_t len;
+   const char* str = luaL_checklstring(L, 1, &len);
+   S indent = current_indent(L, buf);
+   start_output(L, buf);
+   buf.append_indented(SV(str, len), indent);
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Writes binary data as a sequence of C string literals, one per
+/// line, with a trailing line continuation on all but the last.
+///
+/// \details write_c_string_literal(data [, line_length])
+int output_write_c_string_literal(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   std::size_t len;
+   const char* str = luaL_checklstring(L, 1, &len);
+   lua_Integer line_length = luaL_optinteger(L, 2, 0);
+   S separator = " \\\n" + current_indent(L, buf);
+
+   start_output(L, buf);
+   S literal;
+   append_c_string_literal(literal, SV(str, len), (std::size_t)std::max(line_length, (lua_Integer)0), separator);
+   buf.append(literal);
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Returns the current length of the output, starting it first if
+/// necessary so that the prefix is never part of the output that follows.
+int output_position(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   start_output(L, buf);
+   lua_pushinteger(L, (lua_Integer)buf.view().size());
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Returns the output written since output_position() was called.
+int output_since(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   SV data = buf.view();
+   lua_Integer position = luaL_checkinteger(L, 1);
+   luaL_argcheck(L, position >= 0 && (std::size_t)position <= data.size(), 1, "invalid output position");
+   belua::push_string(L, data.substr((std::size_t)position));
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_get_indent_level(lua_State* L) {
+   lua_pushinteger(L, upvalue_output_buffer(L).indent());
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_get_indent(lua_State* L) {
+   belua::push_string(L, current_indent(L, upvalue_output_buffer(L)));
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_indent_newlines(lua_State* L) {
+   std::size_t len;
+   const char* str = luaL_checklstring(L, 1, &len);
+   S indent = current_indent(L, upvalue_output_buffer(L));
+   belua::push_string(L, indent_newlines(SV(str, len), indent));
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_reset_indent(lua_State* L) {
+   upvalue_output_buffer(L).indent(0);
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_indent(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   buf.indent(buf.indent() + (I32)luaL_optinteger(L, 1, 1));
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_unindent(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   buf.indent(buf.indent() - (I32)luaL_optinteger(L, 1, 1));
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_set_indent(lua_State* L) {
+   upvalue_output_buffer(L).indent((I32)luaL_checkinteger(L, 1));
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Throws away any buffered output without writing the postfix or
+/// calling postprocess().
+int output_discard(lua_State* L) {
+   OutputBuffer& buf = upvalue_output_buffer(L);
+   buf.take();
+   buf.indent(0);
+   return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int output_reset(lua_State* L) {
+   belua::push_string(L, finish_output(L, upvalue_output_buffer(L), nullptr));
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void register_output_buffer(lua_State* L) {
+   luaL_Reg fn[] = {
+      { "write", output_write },
+      { "writeln", output_writeln },
+      { "write_lines", output_write_lines },
+      { "write_indented", output_write_indented },
+      { "write_c_string_literal", output_write_c_string_literal },
+      { "output_position", output_position },
+      { "output_since", output_since },
+      { "get_indent_level", output_get_indent_level },
+      { "nl", output_nl },
+      { "write_indent", output_write_indent },
+      { "get_indent", output_get_indent },
+      { "indent_newlines", output_indent_newlines },
+      { "reset_indent", output_reset_indent },
+      { "indent", output_indent },
+      { "unindent", output_unindent },
+      { "set_indent", output_set_indent },
+      { "reset", output_reset },
+      { "discard_output", output_discard },
+      { nullptr, nullptr }
+   };
+
+   luaL_newmetatable(L, output_buffer_metatable);
+   lua_pushcfunction(L, output_buffer_gc);
+   lua_setfield(L, -2, "__gc");
+   lua_pop(L, 1);
+
+   void* ud = lua_newuserdata(L, sizeof(OutputBuffer));
+   new (ud) OutputBuffer();
+   luaL_setmetatable(L, output_buffer_metatable);
+
+   lua_pushvalue(L, -1);
+   lua_rawsetp(L, LUA_REGISTRYINDEX, &output_buffer_key);
+
+   luaL_setfuncs(L, fn, 1);
+}
+
+} // be::limp::()
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Opens the be.limp module, containing native helpers used by the
+/// LIMP core.
+///
+/// \details The include index, .limprc cache, and memo store behind these
+/// helpers belong to the process rather than to a Lua context, so what they
+/// learn while processing one file is reused for every later file.
+int open_limp(lua_State* L) {
+   register_file_batch(L);
+
+   luaL_Reg fn[] = {
+      { "read_file", limp_read_file },
+      { "read_files", limp_read_files },
+      { "prefetch_files", limp_prefetch_files },
+      { "find_include", limp_find_include },
+      { "find_limprc", limp_find_limprc },
+      { "c_string_literal", limp_c_string_literal },
+      { "content_hash", limp_content_hash },
+      { "update_depfile", limp_update_depfile },
+      { "memo_find", limp_memo_find },
+      { "memo_store", limp_memo_store },
+      { "count_metric", limp_count_metric },
+      { "trim_trailing_ws", lua_trim_trailing_ws },
+      { nullptr, nullptr }
+   };
+
+   luaL_newlib(L, fn);
+   register_output_buffer(L);
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int lua_trim_trailing_ws(lua_State* L) {
+   std::size_t len;
+   const char* str = luaL_checklstring(L, 1, &len);
+   belua::push_string(L, trim_trailing_ws(SV(str, len)));
+   return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Finishes the current LIMP comment's output, as reset() would, and
+/// stores it, along with its newline count, in the FinishedOutput passed as
+/// a light userdata.
+///
+/// \details Newlines in the output are normalized to '\n'.
+int lua_finish_output(lua_State* L) {
+   FinishedOutput& result = *static_cast<FinishedOutput*>(lua_touserdata(L, 1));
+
+   if (!global_is_native(L, "reset", output_reset)) {
+      // reset() has been replaced; it is responsible for postprocessing, as it always has been
+      lua_getglobal(L, "reset");
+      lua_call(L, 0, 1);
+      result.text = S(belua::get_string_view(L, -1, SV()));
+      lua_pop(L, 1);
+      result.newlines = normalize_output(result.text, false);
+      return 0;
+   }
+
+   lua_rawgetp(L, LUA_REGISTRYINDEX, &output_buffer_key);
+   OutputBuffer& buf = *static_cast<OutputBuffer*>(luaL_checkudata(L, -1, output_buffer_metatable));
+   result.text = finish_output(L, buf, &result.newlines);
+   return 0;
+}
+
+} // be::limp
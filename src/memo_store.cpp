@@ -0,0 +1,32 @@
+#include "memo_store.hpp"
+
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+bool MemoStore::find(const S& key, Entry& entry) {
+   std::lock_guard<std::mutex> lock(mutex_);
+   auto it = entries_.find(key);
+   if (it == entries_.end()) {
+      return false;
+   }
+   entry = it->second;
+   return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Adds an entry to the store.
+///
+/// \details If another context has already stored a result for the same key,
+/// the existing entry is kept.
+void MemoStore::insert(const S& key, Entry entry) {
+   std::lock_guard<std::mutex> lock(mutex_);
+   entries_.emplace(key, std::move(entry));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+MemoStore& memo_store() {
+   static MemoStore store;
+   return store;
+}
+
+} // be::limp
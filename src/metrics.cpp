@@ -0,0 +1,130 @@
+#include "metrics.hpp"
+#include "atomic_file.hpp"
+#include <cstdio>
+
+namespace be::limp {
+namespace {
+
+struct MetricInfo {
+   const char* name;
+   const char* help;
+   std::atomic<U64> Metrics::* counter;
+   bool nanoseconds;
+};
+
+const MetricInfo metric_info[] = {
+   { "files_considered",           "Input files considered",                                               &Metrics::files_considered,           false },
+   { "files_scanned",              "Input files read to look for LIMP comments",                           &Metrics::files_scanned,              false },
+   { "files_processable",          "Input files containing LIMP comments",                                 &Metrics::files_processable,          false },
+   { "files_unchanged",            "Input files whose .limphash matched their contents",                   &Metrics::files_unchanged,            false },
+   { "files_processed",            "Input files whose LIMP comments were executed",                        &Metrics::files_processed,            false },
+   { "files_modified",             "Processed files whose output differed from the input",                 &Metrics::files_modified,             false },
+   { "files_written",              "Output files written",                                                 &Metrics::files_written,              false },
+   { "hashes_written",             ".limphash records written",                                            &Metrics::hashes_written,             false },
+   { "dependency_records_written", ".limpdeps records written",                                            &Metrics::dependency_records_written, false },
+   { "blocks_executed",            "LIMP comments executed",                                               &Metrics::blocks_executed,            false },
+   { "isolated_blocks_executed",   "LIMP comments executed in an isolated context",                        &Metrics::isolated_blocks_executed,   false },
+   { "contexts_created",           "Lua contexts created",                                                 &Metrics::contexts_created,           false },
+   { "contexts_reused",            "Files processed using an existing Lua context",                        &Metrics::contexts_reused,            false },
+   { "bytes_read",                 "Bytes read from input files, records, and files read by LIMP scripts", &Metrics::bytes_read,                 false },
+   { "bytes_written",              "Bytes written to output files and records",                            &Metrics::bytes_written,              false },
+   { "include_calls",              "Calls to include()",                                                   &Metrics::include_calls,              false },
+   { "template_calls",             "Calls to template()",                                                  &Metrics::template_calls,             false },
+   { "include_cache_hits",         "Calls to include() satisfied by a memoized result",                    &Metrics::include_cache_hits,         false },
+   { "template_cache_hits",        "Calls to template() satisfied by a memoized result",                   &Metrics::template_cache_hits,        false },
+   { "memo_misses",                "Memoizable calls with no stored result",                               &Metrics::memo_misses,                false },
+   { "memo_stores",                "Results stored for pure calls",                                        &Metrics::memo_stores,                false },
+   { "lua_seconds",                "Time spent executing Lua, summed across threads",                      &Metrics::lua_ns,                     true },
+   { "io_seconds",                 "Time spent reading and writing files, summed across threads",          &Metrics::io_ns,                      true },
+   { "run_seconds",                "Total run time",                                                       &Metrics::run_ns,                     true },
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void append_value(S& out, const Metrics& m, const MetricInfo& info) {
+   U64 value = (m.*info.counter).load();
+   if (info.nanoseconds) {
+      char buf[32];
+      std::snprintf(buf, sizeof(buf), "%.9f", (double)value / 1e9);
+      out.append(buf);
+   } else {
+      out.append(std::to_string(value));
+   }
+}
+
+} // be::limp::()
+
+///////////////////////////////////////////////////////////////////////////////
+Metrics& metrics() {
+   static Metrics m;
+   return m;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Looks up a counter by the name used in metrics output.
+///
+/// \returns nullptr if there is no such counter, or if it is a time.
+std::atomic<U64>* find_metric(SV name) {
+   for (const MetricInfo& info : metric_info) {
+      if (!info.nanoseconds && name == info.name) {
+         return &(metrics().*info.counter);
+      }
+   }
+   return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+S format_metrics_json(const Metrics& m) {
+   S out = "{\n";
+   bool first = true;
+   for (const MetricInfo& info : metric_info) {
+      if (!first) {
+         out.append(",\n");
+      }
+      first = false;
+      out.append("   \"");
+      out.append(info.name);
+      out.append("\": ");
+      append_value(out, m, info);
+   }
+   out.append("\n}\n");
+   return out;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Formats metrics using the Prometheus text exposition format, as
+/// expected by the node_exporter textfile collector.
+S format_metrics_prometheus(const Metrics& m) {
+   S out;
+   for (const MetricInfo& info : metric_info) {
+      S name = "limp_";
+      name.append(info.name);
+      name.append("_total");
+
+      out.append("# HELP ");
+      out.append(name);
+      out.push_back(' ');
+      out.append(info.help);
+      out.append("\n# TYPE ");
+      out.append(name);
+      out.append(" counter\n");
+      out.append(name);
+      out.push_back(' ');
+      append_value(out, m, info);
+      out.push_back('\n');
+   }
+   return out;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Writes the current metrics to a file; in Prometheus format if
+/// the extension is .prom, or as JSON otherwise.
+void write_metrics(const Path& path) {
+   const Metrics& m = metrics();
+   if (path.extension() == ".prom") {
+      put_file_contents_atomic(path, format_metrics_prometheus(m));
+   } else {
+      put_file_contents_atomic(path, format_metrics_json(m));
+   }
+}
+
+} // be::limp
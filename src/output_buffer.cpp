@@ -0,0 +1,180 @@
+#include "output_buffer.hpp"
+
+namespace be::limp {
+
+///////////////////////////////////////////////////////////////////////////////
+bool OutputBuffer::started() const {
+   return started_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void OutputBuffer::start() {
+   started_ = true;
+   indent_ = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+I32 OutputBuffer::indent() const {
+   return indent_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void OutputBuffer::indent(I32 indent) {
+   indent_ = indent;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void OutputBuffer::append(SV text) {
+   data_.append(text);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Appends text, inserting the specified indent after each newline.
+void OutputBuffer::append_indented(SV text, SV indent) {
+   if (indent.empty()) {
+      data_.append(text);
+      return;
+   }
+
+   for (;;) {
+      std::size_t nl = text.find('\n');
+      if (nl == SV::npos) {
+         data_.append(text);
+         break;
+      }
+      data_.append(text.substr(0, nl + 1));
+      data_.append(indent);
+      text.remove_prefix(nl + 1);
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+SV OutputBuffer::view() const {
+   return data_;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Retrieves the accumulated output and resets the buffer to its
+/// initial, unstarted state.
+S OutputBuffer::take() {
+   S result;
+   result.swap(data_);
+   started_ = false;
+   return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Appends the indent string for the specified indentation level.
+///
+/// \details Equivalent to base_indent .. string.rep(indent_char, count).
+void append_indent(S& out, SV base_indent, SV indent_char, I32 count) {
+   out.append(base_indent);
+   if (indent_char.size() == 1) {
+      if (count > 0) {
+         out.append((std::size_t)count, indent_char[0]);
+      }
+   } else {
+      for (I32 i = 0; i < count; ++i) {
+         out.append(indent_char);
+      }
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Equivalent to text:gsub('\n', '\n' .. indent)
+S indent_newlines(SV text, SV indent) {
+   OutputBuffer buf;
+   buf.append_indented(text, indent);
+   return buf.take();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Equivalent to text:gsub('[ \t]+(\r?\n)', '%1'):gsub('[ \t]+$', '')
+S trim_trailing_ws(SV text) {
+   S result;
+   result.reserve(text.size());
+
+   std::size_t ws_begin = 0;
+   bool in_ws = false;
+   for (std::size_t i = 0, n = text.size(); i < n; ++i) {
+      char c = text[i];
+      if (c == ' ' || c == '\t') {
+         if (!in_ws) {
+            ws_begin = result.size();
+            in_ws = true;
+         }
+      } else if (in_ws) {
+         if (c == '\n' || (c == '\r' && i + 1 < n && text[i + 1] == '\n')) {
+            result.resize(ws_begin);
+         }
+         in_ws = false;
+      }
+      result.push_back(c);
+   }
+
+   if (in_ws) {
+      result.resize(ws_begin);
+   }
+
+   return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// \brief  Converts all newlines to '\n', optionally removes trailing
+/// whitespace from each line (as trim_trailing_ws() would), and counts
+/// newlines, all in a single in-place pass.
+///
+/// \returns the number of newlines in the result.
+std::size_t normalize_output(S& text, bool trim_trailing_ws) {
+   std::size_t newlines = 0;
+   std::size_t ws_begin = 0;
+   bool in_ws = false;
+
+   std::size_t w = 0;
+   for (std::size_t r = 0, n = text.size(); r < n; ++r) {
+      char c = text[r];
+      if (c == '\n' || c == '\r') {
+         bool trim_line = trim_trailing_ws && in_ws && c == '\n';
+         if (c == '\r') {
+            std::size_t next = r + 1;
+            if (trim_trailing_ws) {
+               // trimming "\r \n" leaves "\r\n", which then becomes a single newline
+               while (next < n && (text[next] == ' ' || text[next] == '\t')) {
+                  ++next;
+               }
+            }
+            if (next < n && text[next] == '\n') {
+               // whitespace before the '\r' is only trimmed if the '\n' follows immediately
+               trim_line = trim_trailing_ws && in_ws && next == r + 1;
+               r = next;
+            }
+         }
+         if (trim_line) {
+            w = ws_begin;
+         }
+         in_ws = false;
+         text[w++] = '\n';
+         ++newlines;
+         continue;
+      }
+
+      if (c == ' ' || c == '\t') {
+         if (!in_ws) {
+            ws_begin = w;
+            in_ws = true;
+         }
+      } else {
+         in_ws = false;
+      }
+      text[w++] = c;
+   }
+
+   if (in_ws && trim_trailing_ws) {
+      w = ws_begin;
+   }
+
+   text.resize(w);
+   return newlines;
+}
+
+} // be::limp
@@ -0,0 +1,89 @@
+// Checks that an include script already loaded (and cached) by a Lua
+// context is still reported as a dependency when it is used again: two
+// buffers that include the same script are processed through one session
+// that reuses its context, and must report the same dependencies.
+//
+// Not built by build.lua; compile it together with the limp sources and
+// link it the same way as the limp app.  Returns nonzero on failure.
+
+#include "limp_c.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+///////////////////////////////////////////////////////////////////////////////
+void write_file(const fs::path& path, const char* contents) {
+   std::ofstream ofs(path, std::ios_base::out | std::ios_base::trunc);
+   ofs << contents;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+bool process(limp_session* session, const fs::path& path, std::set<std::string>& deps) {
+   const char* content = "/*!! include 'dep' !! */\n";
+   limp_language lang { sizeof(limp_language), "/*", "*/", nullptr, nullptr };
+
+   limp_result* result = limp_process(session, content, std::strlen(content), path.u8string().c_str(), &lang);
+   if (!result) {
+      std::fprintf(stderr, "%s: limp_process() returned NULL\n", path.u8string().c_str());
+      return false;
+   }
+
+   const char* error = limp_result_error(result);
+   if (error) {
+      std::fprintf(stderr, "%s: %s\n", path.u8string().c_str(), error);
+      limp_result_destroy(result);
+      return false;
+   }
+
+   for (std::size_t i = 0, n = limp_result_dependency_count(result); i < n; ++i) {
+      deps.insert(limp_result_dependency(result, i));
+   }
+   limp_result_destroy(result);
+   return true;
+}
+
+} // ()
+
+///////////////////////////////////////////////////////////////////////////////
+int main() {
+   fs::path dir = fs::temp_directory_path() / "limp_include_cache_dependencies";
+   fs::remove_all(dir);
+   fs::create_directories(dir);
+   write_file(dir / ".limprc", "register_include_dir(root_dir)\n");
+   write_file(dir / "dep.lua", "write '// dep'\n");
+
+   int status = 0;
+   limp_session* session = limp_session_create(LIMP_SESSION_REUSE_CONTEXTS);
+   if (!session) {
+      std::fprintf(stderr, "limp_session_create() failed\n");
+      return 1;
+   }
+
+   std::set<std::string> first, second;
+   if (!process(session, dir / "a.h", first) || !process(session, dir / "b.h", second)) {
+      status = 1;
+   } else if (first.empty()) {
+      std::fprintf(stderr, "no dependencies reported for the first file\n");
+      status = 1;
+   } else if (first != second) {
+      std::fprintf(stderr, "dependencies differ between files sharing a warm context:\n");
+      for (auto& dep : first) {
+         std::fprintf(stderr, "  a.h: %s\n", dep.c_str());
+      }
+      for (auto& dep : second) {
+         std::fprintf(stderr, "  b.h: %s\n", dep.c_str());
+      }
+      status = 1;
+   }
+
+   limp_session_destroy(session);
+   fs::remove_all(dir);
+   return status;
+}